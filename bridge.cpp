@@ -1,11 +1,32 @@
 // bridge.cpp - include per compatibilità Arduino IDE
 #include "lib/core/Core.cpp"
 #include "lib/core/EventBus.cpp"
+#include "lib/core/HealthLog.cpp"
+#include "lib/hardware/Backlight.cpp"
 #include "lib/hardware/DisplayManager.cpp"
 #include "lib/hardware/EncoderManager.cpp"
+#include "lib/hardware/FontCache.cpp"
+#include "lib/hardware/IndexedPalette.cpp"
 #include "lib/hardware/LEDManager.cpp"
+#include "lib/hardware/LvglAllocator.cpp"
+#include "lib/hardware/PixelConverter.cpp"
+#include "lib/hardware/RenderStats.cpp"
+#include "lib/hardware/ScreenRegistry.cpp"
+#include "lib/hardware/UiTheme.cpp"
+#include "lib/hardware/VirtualList.cpp"
+#include "lib/hardware/PerfHud.cpp"
+#include "lib/hardware/ScreenCapture.cpp"
+#include "lib/network/DisplayMirror.cpp"
+#include "lib/network/WebSocketHandshake.cpp"
 #include "lib/network/WebServerManager.cpp"
 #include "lib/network/WiFiManager.cpp"
 #include "lib/utils/NTPManager.cpp"
+#include "lib/utils/QRBlitter.cpp"
+#include "lib/utils/QRCodeCache.cpp"
 #include "lib/utils/QRCodeManager.cpp"
 #include "lib/prefs/PreferencesManager.cpp"
+
+// Subset fonts exist only after running tools/fonts/subset_fonts.py
+#if __has_include("lib/fonts/UiFonts.cpp")
+#include "lib/fonts/UiFonts.cpp"
+#endif
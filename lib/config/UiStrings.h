@@ -0,0 +1,48 @@
+/**
+ * CloudMouse SDK - UI String Table
+ *
+ * Every fixed text shown by DisplayManager, grouped by the font it is rendered with.
+ * tools/fonts/subset_fonts.py reads this file to decide which glyphs each subset font
+ * needs, so a string rendered with a subset font must live in the matching section.
+ *
+ * Section Markers:
+ * - "// @font <name> <size> [extra="<chars>"]" starts a section rendered with the
+ *   subset font UI_FONT_<NAME> at <size> px; extra adds glyphs used by runtime text
+ * - "// @font <name> default" marks text rendered with LV_FONT_DEFAULT (not subset,
+ *   runtime values such as SSIDs and URLs can contain any character)
+ *
+ * printf-style placeholders are ignored by the generator; cover their possible
+ * values with extra="...".
+ */
+
+#pragma once
+
+namespace CloudMouse::UiStrings
+{
+    // @font title 28
+    constexpr const char *HELLO_TITLE = "Hello CloudMouse!";
+    constexpr const char *WIFI_CONNECTING_TITLE = "Connecting to WiFi";
+
+    // @font status 20
+    constexpr const char *HELLO_READY = "Ready!";
+    constexpr const char *HELLO_ROTATION = "Encoder rotation: %s";
+    constexpr const char *HELLO_ROTATION_RIGHT = "RIGHT";
+    constexpr const char *HELLO_ROTATION_LEFT = "LEFT";
+    constexpr const char *HELLO_CLICK = "Click!";
+    constexpr const char *HELLO_LONG_PRESS = "Long Press!";
+    constexpr const char *WIFI_PLEASE_WAIT = "Please wait...";
+
+    // @font body default
+    constexpr const char *HEADER_BOILERPLATE = "CloudMouse Boilerplate";
+    constexpr const char *HEADER_WIFI_SETUP = "WiFi Setup Required";
+    constexpr const char *HEADER_WIFI_CONFIG = "WiFi Configuration";
+    constexpr const char *HELLO_INSTRUCTIONS = "Rotate the knob or push the button";
+    constexpr const char *AP_MODE_TITLE = "Connect to CloudMouse";
+    constexpr const char *AP_MODE_SSID_PLACEHOLDER = "SSID: ...";
+    constexpr const char *AP_MODE_PASS_PLACEHOLDER = "Pass: ...";
+    constexpr const char *AP_CONNECTED_TITLE = "✅ Connected!";
+    constexpr const char *AP_CONNECTED_SUBTITLE = "Scan QR to setup WiFi";
+    constexpr const char *URL_PLACEHOLDER = "http://...";
+    constexpr const char *HEADER_LIST_DEMO = "List Demo";
+    constexpr const char *LIST_DEMO_ITEM = "Item %lu";
+}
@@ -5,22 +5,31 @@
 #define LV_COLOR_16_SWAP 1
 #define LV_MEM_SIZE (48U * 1024U)
 
+// Render targets: RGB565 and L8 (indexed colour mode, see DISPLAY_INDEXED_COLOR)
+#define LV_DRAW_SW_SUPPORT_RGB565 1
+#define LV_DRAW_SW_SUPPORT_L8 1
+
+// LVGL heap is provided by lib/hardware/LvglAllocator.cpp (internal + PSRAM pools);
+// LV_MEM_SIZE only applies when switching back to LV_STDLIB_BUILTIN
+#define LV_USE_STDLIB_MALLOC LV_STDLIB_CUSTOM
+
+// Only the default size is compiled in full. Title/status text uses subset fonts
+// generated by tools/fonts/subset_fonts.py; until lib/fonts/ exists the full 20/28 px
+// sizes are kept as fallback (see lib/hardware/UiFonts.h)
 #define LV_FONT_MONTSERRAT_14 1
-#define LV_FONT_MONTSERRAT_16 1
-#define LV_FONT_MONTSERRAT_18 1
+#if __has_include("../fonts/UiFontsGenerated.h")
+#define LV_FONT_MONTSERRAT_20 0
+#define LV_FONT_MONTSERRAT_28 0
+#else
 #define LV_FONT_MONTSERRAT_20 1
-#define LV_FONT_MONTSERRAT_24 1
 #define LV_FONT_MONTSERRAT_28 1
-#define LV_FONT_MONTSERRAT_32 1
-#define LV_FONT_MONTSERRAT_36 1
-#define LV_FONT_MONTSERRAT_48 1
+#endif
 
 #define LV_FONT_DEFAULT &lv_font_montserrat_14
 #define LV_TXT_ENC LV_TXT_ENC_UTF8
 
-#define LV_TICK_CUSTOM 1
-#define LV_TICK_CUSTOM_INCLUDE "Arduino.h"
-#define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())
+// Tick: LVGL 9 has no LV_TICK_CUSTOM, DisplayManager::init() registers
+// Utils::Clock::lvglTick with lv_tick_set_cb() (see lib/utils/Clock.h)
 
 #define LV_USE_LOG 1
 #define LV_LOG_LEVEL LV_LOG_LEVEL_WARN
@@ -17,6 +17,9 @@ namespace CloudMouse
   {
     Serial.println("🚀 Core initialization starting...");
 
+    // Restore health history retained across soft resets
+    HealthLog::instance().begin();
+
     // Output device identification
     DeviceID::printDeviceInfo();
 
@@ -38,7 +41,10 @@ namespace CloudMouse
       return;
     }
 
-    // Create UI task on Core 1 for smooth 30Hz rendering
+    inputStageMutex = xSemaphoreCreateMutex();
+    setSplitPipeline(splitPipeline.load());
+
+    // Render stage on Core 1: LVGL at 30Hz
     xTaskCreatePinnedToCore(
         uiTaskFunction,
         "UI_Task",
@@ -49,9 +55,20 @@ namespace CloudMouse
         1 // Pin to Core 1
     );
 
-    if (uiTaskHandle)
+    // Input stage on Core 1: preempts rendering so event dispatch keeps its period
+    xTaskCreatePinnedToCore(
+        inputTaskFunction,
+        "Input_Task",
+        4096, // 4KB stack (encoder state machine and log lines only)
+        this,
+        2, // Above the render stage
+        &inputTaskHandle,
+        1);
+
+    if (uiTaskHandle && inputTaskHandle && inputStageMutex)
     {
-      Serial.println("✅ UI Task running on Core 1 (30Hz)");
+      Serial.printf("✅ UI Tasks running on Core 1 (input %dHz, render %dHz)\n",
+                    1000 / UI_INPUT_INTERVAL_MS, 1000 / UI_RENDER_INTERVAL_MS);
 
       // Start LED animation system
       if (ledManager)
@@ -111,8 +128,8 @@ namespace CloudMouse
       handleWiFiConnection();
     }
 
-    // Web server updates when in AP mode
-    if (wifi && wifi->getState() == WiFiManager::WiFiState::AP_MODE && webServer)
+    // Web server updates when in AP mode or while the display mirror runs
+    if (webServer && ((wifi && wifi->getState() == WiFiManager::WiFiState::AP_MODE) || webServer->isMirrorRunning()))
     {
       webServer->update();
     }
@@ -126,6 +143,7 @@ namespace CloudMouse
     // Process user commands and system events
     processSerialCommands();
     processEvents();
+    drainCapture();
 
     coordinationCycles++;
 
@@ -229,6 +247,7 @@ namespace CloudMouse
 
         if (webServer)
         {
+          webServer->setScreenCapture(display ? &display->getCapture() : nullptr);
           webServer->init();
           String apIP = wifi->getAPIP();
           String apSSID = wifi->getSSID();
@@ -295,6 +314,10 @@ namespace CloudMouse
     {
       eventsProcessed++;
 
+      // Keep short event history for post-mortem health snapshots
+      memmove(recentEvents + 1, recentEvents, sizeof(recentEvents) - 1);
+      recentEvents[0] = (uint8_t)event.type;
+
       switch (event.type)
       {
       case EventType::ENCODER_ROTATION:
@@ -326,8 +349,10 @@ namespace CloudMouse
       ledManager->activate();
     }
 
-    // Forward to UI system
+#if !ENCODER_DIRECT_INPUT
+    // Forward to UI system (direct input already delivered it on the UI task)
     EventBus::instance().sendToUI(event);
+#endif
   }
 
   void Core::handleEncoderClick(const Event &event)
@@ -343,8 +368,10 @@ namespace CloudMouse
     // Audio feedback
     SimpleBuzzer::buzz();
 
-    // Forward to UI system
+#if !ENCODER_DIRECT_INPUT
+    // Forward to UI system (direct input already delivered it on the UI task)
     EventBus::instance().sendToUI(event);
+#endif
   }
 
   void Core::handleEncoderLongPress(const Event &event)
@@ -360,12 +387,14 @@ namespace CloudMouse
     // Audio feedback: error pattern
     SimpleBuzzer::error();
 
-    // Forward to UI system
+#if !ENCODER_DIRECT_INPUT
+    // Forward to UI system (direct input already delivered it on the UI task)
     EventBus::instance().sendToUI(event);
+#endif
   }
 
   // ============================================================================
-  // UI TASK (Core 1 - 30Hz)
+  // UI TASKS (Core 1 - input 200Hz, render 30Hz)
   // ============================================================================
 
   void Core::uiTaskFunction(void *param)
@@ -374,72 +403,279 @@ namespace CloudMouse
     core->runUITask();
   }
 
+  void Core::inputTaskFunction(void *param)
+  {
+    Core *core = static_cast<Core *>(param);
+    core->runInputTask();
+  }
+
   void Core::runUITask()
   {
     TickType_t lastWake = xTaskGetTickCount();
 
     Serial.println("🎮 UI Task started on Core 1");
 
+    // LVGL reads encoder input from the accumulator filled by encoder->update()
+    if (encoder && display)
+    {
+      display->setEncoderInput(&encoder->getInput());
+    }
+
     while (true)
     {
-      // Read encoder input
-      if (encoder)
+      uint32_t frameStart = micros();
+
+      // Serial pipeline: sample input in this loop, before rendering
+      if (!splitPipeline.load())
       {
-        encoder->update();
+        runInputStage();
+      }
 
-        // Handle rotation
-        int movement = encoder->getMovement();
-        if (movement != 0)
-        {
-          Event rotationEvent(EventType::ENCODER_ROTATION, movement);
-          EventBus::instance().sendToMain(rotationEvent);
-        }
+      // Screen feedback for input sampled since the previous frame
+      drainLocalInput();
 
-        // Handle click
-        if (encoder->getClicked())
-        {
-          Event clickEvent(EventType::ENCODER_CLICK);
-          EventBus::instance().sendToMain(clickEvent);
-        }
+      // Update display rendering
+      if (display)
+      {
+        display->update();
 
-        // Handle long press
-        if (encoder->getLongPressed())
+        // Nothing is drawn while paused or asleep: let the encoder sampler idle too
+        if (encoder)
         {
-          Event longPressEvent(EventType::ENCODER_LONG_PRESS);
-          EventBus::instance().sendToMain(longPressEvent);
+          const DisplayPowerState power = display->getPowerState();
+          encoder->setIdleSampling(power == DisplayPowerState::PAUSED || power == DisplayPowerState::SLEEPING);
         }
       }
 
-      // Update display rendering
-      if (display)
+      recordFrameTime(micros() - frameStart);
+
+      // Maintain 30Hz update rate (33ms intervals)
+      vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(UI_RENDER_INTERVAL_MS));
+    }
+  }
+
+  void Core::runInputTask()
+  {
+    TickType_t lastWake = xTaskGetTickCount();
+
+    Serial.println("🎛️ Input Task started on Core 1");
+
+    while (true)
+    {
+      if (splitPipeline.load())
       {
-        display->update();
+        runInputStage();
       }
 
-      // Maintain 30Hz update rate (33ms intervals)
-      vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(33));
+      vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(UI_INPUT_INTERVAL_MS));
     }
   }
 
+  void Core::runInputStage()
+  {
+    // Only one task samples at a time while the pipeline mode switches
+    xSemaphoreTake(inputStageMutex, portMAX_DELAY);
+
+    const int64_t now = Utils::Clock::nowUs();
+    portENTER_CRITICAL(&inputStatsMux);
+    if (lastInputSampleUs)
+    {
+      inputJitter.record((uint32_t)(now - lastInputSampleUs));
+    }
+    lastInputSampleUs = now;
+    portEXIT_CRITICAL(&inputStatsMux);
+
+    // Read encoder input
+    if (encoder)
+    {
+      encoder->update();
+
+      // Handle rotation
+      int movement = encoder->getMovement();
+      if (movement != 0)
+      {
+        Event rotationEvent(EventType::ENCODER_ROTATION, movement);
+        dispatchEncoderEvent(rotationEvent);
+      }
+
+      // Handle click
+      if (encoder->getClicked())
+      {
+        Event clickEvent(EventType::ENCODER_CLICK);
+        dispatchEncoderEvent(clickEvent);
+      }
+
+      // Handle long press
+      if (encoder->getLongPressed())
+      {
+        Event longPressEvent(EventType::ENCODER_LONG_PRESS);
+        dispatchEncoderEvent(longPressEvent);
+      }
+
+      // Ultra-long press toggles the performance HUD
+      if (encoder->getUltraLongPressed())
+      {
+        EventBus::instance().sendToUI(Event(EventType::DISPLAY_PERF_HUD, -1));
+      }
+    }
+
+    xSemaphoreGive(inputStageMutex);
+  }
+
+  void Core::drainLocalInput()
+  {
+    if (!display) return;
+
+    Event event;
+    while (inputHandoff.pop(event))
+    {
+      display->processLocalInput(event);
+    }
+  }
+
+  void Core::setSplitPipeline(bool split)
+  {
+    splitPipeline.store(split);
+
+    // Figures of the previous mode are not comparable
+    portENTER_CRITICAL(&inputStatsMux);
+    inputJitter.reset((split ? UI_INPUT_INTERVAL_MS : UI_RENDER_INTERVAL_MS) * 1000);
+    lastInputSampleUs = 0;
+    portEXIT_CRITICAL(&inputStatsMux);
+  }
+
+  void Core::printUiTiming()
+  {
+    portENTER_CRITICAL(&inputStatsMux);
+    const InputJitter stats = inputJitter;
+    inputJitter.reset(stats.nominalUs);
+    portEXIT_CRITICAL(&inputStatsMux);
+
+    Serial.printf("⏱️ UI pipeline: %s (input every %d ms, render every %d ms)\n",
+                  splitPipeline.load() ? "split" : "serial",
+                  splitPipeline.load() ? UI_INPUT_INTERVAL_MS : UI_RENDER_INTERVAL_MS, UI_RENDER_INTERVAL_MS);
+
+    if (stats.samples == 0)
+    {
+      Serial.println("   No input stage runs yet");
+      return;
+    }
+
+    Serial.printf("   Event dispatch: %lu runs, avg interval %lu us (nominal %lu us)\n",
+                  (unsigned long)stats.samples, (unsigned long)(stats.intervalTotalUs / stats.samples),
+                  (unsigned long)stats.nominalUs);
+    Serial.printf("   Jitter: avg %lu us, max %lu us, longest gap %lu us, missed slots %lu\n",
+                  (unsigned long)(stats.jitterTotalUs / stats.samples), (unsigned long)stats.jitterMaxUs,
+                  (unsigned long)stats.intervalMaxUs, (unsigned long)stats.missed);
+    Serial.printf("   Input handoff drops: %lu\n", (unsigned long)inputHandoff.getDropped());
+    Serial.printf("   Rotation sampled every %d us by the encoder timer in both modes\n",
+                  ENCODER_SAMPLE_INTERVAL_US);
+  }
+
+  void Core::drainCapture()
+  {
+    if (!display) return;
+
+    ScreenCapture &capture = display->getCapture();
+    if (capture.getSink() != CaptureSink::SERIAL_PORT) return;
+
+    // Whole packets per write: log lines from other tasks can only land between them
+    static uint8_t packet[CAPTURE_PACKET_MAX_BYTES];
+    size_t sent = 0;
+    size_t bytes;
+    while (sent < CAPTURE_SERIAL_BYTES_PER_LOOP && (bytes = capture.readPacket(packet, sizeof(packet))) > 0)
+    {
+      Serial.write(packet, bytes);
+      sent += bytes;
+    }
+  }
+
+  void Core::dispatchEncoderEvent(const Event &event)
+  {
+#if ENCODER_DIRECT_INPUT
+    // UI feedback on the next render frame (LVGL belongs to the render stage);
+    // Core 0 only handles LED / buzzer side effects
+    inputHandoff.push(event);
+#endif
+    EventBus::instance().sendToMain(event);
+  }
+
   // ============================================================================
   // SYSTEM HEALTH MONITORING
   // ============================================================================
 
+  void Core::recordFrameTime(uint32_t frameUs)
+  {
+    portENTER_CRITICAL(&frameStatsMux);
+    frameTimeTotalUs += frameUs;
+    frameCount++;
+    if (frameUs > frameTimeMaxUs)
+    {
+      frameTimeMaxUs = frameUs;
+    }
+    portEXIT_CRITICAL(&frameStatsMux);
+  }
+
+  void Core::recordHealthSnapshot(uint32_t freeHeap, uint32_t minFreeHeap)
+  {
+    HealthSnapshot snapshot = {};
+    snapshot.uptimeMs = millis();
+    snapshot.freeHeap = freeHeap;
+    snapshot.minFreeHeap = minFreeHeap;
+    snapshot.largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+    snapshot.freePsram = ESP.getFreePsram();
+    snapshot.lvglInternal = LvglAllocator::getStats(LvglPool::INTERNAL).usedBytes;
+    snapshot.lvglPsram = LvglAllocator::getStats(LvglPool::PSRAM).usedBytes;
+    snapshot.systemState = (uint8_t)currentState;
+    snapshot.uiQueueDepth = EventBus::instance().getUIQueueCount();
+    snapshot.mainQueueDepth = EventBus::instance().getMainQueueCount();
+    memcpy(snapshot.lastEvents, recentEvents, sizeof(snapshot.lastEvents));
+
+    // Sample and reset frame statistics for the next interval
+    portENTER_CRITICAL(&frameStatsMux);
+    uint32_t avgUs = frameCount ? frameTimeTotalUs / frameCount : 0;
+    uint32_t maxUs = frameTimeMaxUs;
+    frameTimeTotalUs = 0;
+    frameTimeMaxUs = 0;
+    frameCount = 0;
+    portEXIT_CRITICAL(&frameStatsMux);
+
+    snapshot.frameTimeAvgUs = avgUs > UINT16_MAX ? UINT16_MAX : avgUs;
+    snapshot.frameTimeMaxUs = maxUs > UINT16_MAX ? UINT16_MAX : maxUs;
+
+    HealthLog::instance().record(snapshot);
+  }
+
   void Core::checkHealth()
   {
     uint32_t freeHeap = ESP.getFreeHeap();
     uint32_t minFreeHeap = ESP.getMinFreeHeap();
 
+    recordHealthSnapshot(freeHeap, minFreeHeap);
+
     Serial.printf("🏥 Health: Free=%d, Min=%d, Tasks=%d, Cycles=%d, Events=%d\n",
                   freeHeap, minFreeHeap, uxTaskGetNumberOfTasks(),
                   coordinationCycles, eventsProcessed);
 
+    const LvglPoolStats &lvglInternal = LvglAllocator::getStats(LvglPool::INTERNAL);
+    const LvglPoolStats &lvglPsram = LvglAllocator::getStats(LvglPool::PSRAM);
+    Serial.printf("🧠 LVGL heap: internal=%lu (peak %lu), psram=%lu (peak %lu), fails=%lu, frag=%u%%\n",
+                  (unsigned long)lvglInternal.usedBytes, (unsigned long)lvglInternal.peakBytes,
+                  (unsigned long)lvglPsram.usedBytes, (unsigned long)lvglPsram.peakBytes,
+                  (unsigned long)(lvglInternal.failures + lvglPsram.failures),
+                  LvglAllocator::getFragmentation(LvglPool::INTERNAL));
+
     // Monitor UI task stack usage
     if (uiTaskHandle)
     {
       UBaseType_t uiStack = uxTaskGetStackHighWaterMark(uiTaskHandle);
       Serial.printf("🎮 UI Task stack remaining: %d bytes\n", uiStack * sizeof(StackType_t));
     }
+    if (inputTaskHandle)
+    {
+      UBaseType_t inputStack = uxTaskGetStackHighWaterMark(inputTaskHandle);
+      Serial.printf("🎛️ Input Task stack remaining: %d bytes\n", inputStack * sizeof(StackType_t));
+    }
 
     // Monitor LED task stack usage
     if (ledManager && ledManager->getAnimationTaskHandle())
@@ -537,6 +773,26 @@ namespace CloudMouse
             Serial.println("  hard reset  - Factory reset (clear all settings)");
             Serial.println("  status      - Show system information");
             Serial.println("  get uuid    - Get device identification");
+            Serial.println("  health log  - Dump health snapshots retained across reboots");
+            Serial.println("  health clear - Clear retained health snapshots");
+            Serial.println("  display bench - Measure full-screen redraw time");
+            Serial.println("  display sweep - Benchmark LVGL buffer modes and band heights");
+            Serial.println("  display buffers <internal|psram|hybrid> <lines> - Reallocate LVGL buffers");
+            Serial.println("  display stats - Show per-screen redraw and SPI statistics (and reset)");
+            Serial.println("  display overlay on|off - Outline redrawn rectangles on screen");
+            Serial.println("  display screens - Show built screens and their LVGL heap usage");
+            Serial.println("  display memory - Show LVGL heap usage per pool (internal/PSRAM)");
+            Serial.println("  display fonts - Show font cache and benchmark flash vs RAM glyphs");
+            Serial.println("  display qr - Show cached QR codes and encode/render timings");
+            Serial.println("  display styles - Benchmark local vs shared theme styles (heap, redraw)");
+            Serial.println("  display list <items> - Show the virtualised list demo");
+            Serial.println("  display hud on|off|toggle - Performance HUD (also: ultra-long press)");
+            Serial.println("  display capture - Screenshot as binary packets (tools/capture/decode_capture.py)");
+            Serial.println("  display stream <fps>|off - Stream changed screen regions as binary packets");
+            Serial.println("  display mirror on|off - Live screen viewer in the browser (WebSocket, port 81)");
+            Serial.println("  display color rgb565|indexed|bench - LVGL render format (indexed: L8 + palette LUT)");
+            Serial.println("  ui pipeline split|serial - Separate input/render tasks or one UI loop");
+            Serial.println("  ui timing   - Show input event dispatch jitter (and reset)");
             Serial.println("  help        - Show this help\n");
 
             // System status
@@ -562,6 +818,142 @@ namespace CloudMouse
             }
             Serial.println();
           }
+          else if (commandBuffer == "health log")
+          {
+            Serial.printf("🩺 Boot #%u, last reset: %s\n",
+                          HealthLog::instance().getBootCount(),
+                          HealthLog::resetReasonName(HealthLog::instance().getResetReason()));
+            HealthLog::instance().dump();
+          }
+          else if (commandBuffer == "display bench")
+          {
+            // LVGL is owned by the UI task - run benchmark there
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_BENCHMARK, 20));
+          }
+          else if (commandBuffer == "display sweep")
+          {
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_BUFFER_SWEEP, 5));
+          }
+          else if (commandBuffer.startsWith("display buffers "))
+          {
+            String args = commandBuffer.substring(16);
+            int space = args.indexOf(' ');
+            String modeName = space >= 0 ? args.substring(0, space) : args;
+            int lines = space >= 0 ? args.substring(space + 1).toInt() : DISPLAY_BUFFER_LINES;
+
+            int mode = -1;
+            if (modeName == "internal") mode = (int)DisplayBufferMode::INTERNAL_DMA;
+            else if (modeName == "psram") mode = (int)DisplayBufferMode::PSRAM;
+            else if (modeName == "hybrid") mode = (int)DisplayBufferMode::HYBRID;
+
+            if (mode < 0 || lines <= 0)
+            {
+              Serial.println("❌ Usage: display buffers <internal|psram|hybrid> <lines>");
+            }
+            else
+            {
+              EventBus::instance().sendToUI(Event(EventType::DISPLAY_BUFFER_CONFIG, (mode << 16) | lines));
+            }
+          }
+          else if (commandBuffer == "display stats")
+          {
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_RENDER_STATS, 1));
+          }
+          else if (commandBuffer == "display overlay on" || commandBuffer == "display overlay off")
+          {
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_REDRAW_OVERLAY, commandBuffer.endsWith("on") ? 1 : 0));
+          }
+          else if (commandBuffer == "display fonts")
+          {
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_FONT_BENCHMARK, 20));
+          }
+          else if (commandBuffer == "display qr")
+          {
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_QR_STATS));
+          }
+          else if (commandBuffer == "display styles")
+          {
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_STYLE_BENCHMARK, 20));
+          }
+          else if (commandBuffer.startsWith("display list"))
+          {
+            int items = commandBuffer.length() > 12 ? commandBuffer.substring(12).toInt() : 0;
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_LIST_DEMO, items));
+          }
+          else if (commandBuffer.startsWith("display hud"))
+          {
+            int value = commandBuffer.endsWith("on") ? 1 : commandBuffer.endsWith("off") ? 0 : -1;
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_PERF_HUD, value));
+          }
+          else if ((commandBuffer == "display capture" || commandBuffer.startsWith("display stream")) &&
+                   webServer && webServer->hasMirrorViewer())
+          {
+            Serial.println("❌ Display mirror is streaming, capture unavailable (display mirror off)");
+          }
+          else if (commandBuffer == "display capture")
+          {
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_CAPTURE, 0));
+          }
+          else if (commandBuffer.startsWith("display stream"))
+          {
+            int fps = commandBuffer.endsWith("off") ? -1 : commandBuffer.substring(14).toInt();
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_CAPTURE, fps > 0 ? fps : -1));
+          }
+          else if (commandBuffer.startsWith("display mirror"))
+          {
+            if (!webServer || !display)
+            {
+              Serial.println("❌ Display mirror unavailable");
+            }
+            else if (commandBuffer.endsWith("off"))
+            {
+              webServer->stopMirror();
+              webServer->printMirror();
+            }
+            else if (!wifi || (!wifi->isConnected() && wifi->getState() != WiFiManager::WiFiState::AP_MODE))
+            {
+              Serial.println("❌ Display mirror needs WiFi (connected or setup AP)");
+            }
+            else
+            {
+              webServer->setScreenCapture(&display->getCapture());
+              if (webServer->startMirror())
+              {
+                String ip = wifi->isConnected() ? wifi->getLocalIP() : wifi->getAPIP();
+                Serial.printf("📺 Viewer: http://%s:%d/\n", ip.c_str(), MIRROR_PORT);
+              }
+            }
+          }
+          else if (commandBuffer == "display color rgb565" || commandBuffer == "display color indexed")
+          {
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_COLOR_MODE, commandBuffer.endsWith("indexed") ? 1 : 0));
+          }
+          else if (commandBuffer == "display color bench")
+          {
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_COLOR_MODE, -10));
+          }
+          else if (commandBuffer == "display memory")
+          {
+            LvglAllocator::print();
+          }
+          else if (commandBuffer == "display screens")
+          {
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_SCREEN_STATS));
+          }
+          else if (commandBuffer == "health clear")
+          {
+            HealthLog::instance().clear();
+            Serial.println("✅ Health log cleared");
+          }
+          else if (commandBuffer == "ui pipeline split" || commandBuffer == "ui pipeline serial")
+          {
+            setSplitPipeline(commandBuffer.endsWith("split"));
+            Serial.printf("🎛️ UI pipeline: %s\n", isSplitPipeline() ? "split input/render tasks" : "single UI loop");
+          }
+          else if (commandBuffer == "ui timing")
+          {
+            printUiTiming();
+          }
           else
           {
             Serial.printf("❌ Unknown command: '%s'\n", commandBuffer.c_str());
@@ -9,22 +9,34 @@
  *
  * Architecture:
  * - Core 0: Main coordination, WiFi, event processing, system health
- * - Core 1: UI rendering, encoder input, display updates (30Hz)
+ * - Core 1: input stage (button debounce and encoder event dispatch, 200Hz) and
+ *   render stage (LVGL, 30Hz), split into two tasks (see UiPipeline.h); rotation is
+ *   sampled by the encoder's esp_timer
  */
 
 #pragma once
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <esp_heap_caps.h>
 #include "EventBus.h"
 #include "Events.h"
+#include "HealthLog.h"
+#include "UiPipeline.h"
 #include "../prefs/PreferencesManager.h"
 #include "../hardware/LEDManager.h"
 #include "../hardware/EncoderManager.h"
 #include "../hardware/DisplayManager.h"
+#include "../hardware/LvglAllocator.h"
 #include "../hardware/SimpleBuzzer.h"
 #include "../network/WebServerManager.h"
+#include "../utils/Clock.h"
 
+// Screen capture bytes written to Serial per coordination cycle (20 Hz)
+#ifndef CAPTURE_SERIAL_BYTES_PER_LOOP
+#define CAPTURE_SERIAL_BYTES_PER_LOOP (16 * 1024)
+#endif
 
 namespace CloudMouse
 {
@@ -74,7 +86,7 @@ namespace CloudMouse
     // System lifecycle management
     void initialize();  // Initialize core systems
     void start();       // Start normal operation
-    void startUITask(); // Launch UI task on Core 1
+    void startUITask(); // Launch input and render tasks on Core 1
 
     // Main coordination loop (runs on Core 0 at 20Hz)
     void coordinationLoop();
@@ -97,6 +109,10 @@ namespace CloudMouse
     SystemState getState() const { return currentState; }
     void setState(SystemState state);
 
+    // UI pipeline: split (input and render tasks) or serial (single loop)
+    void setSplitPipeline(bool split);
+    bool isSplitPipeline() const { return splitPipeline.load(); }
+
   private:
     // Singleton pattern enforcement
     Core() = default;
@@ -120,16 +136,42 @@ namespace CloudMouse
 
     // System services
     PreferencesManager prefs;
-    TaskHandle_t uiTaskHandle = nullptr;
+    TaskHandle_t uiTaskHandle = nullptr;    // Render stage
+    TaskHandle_t inputTaskHandle = nullptr; // Input stage
+
+    // Split UI pipeline (Core 1)
+    std::atomic<bool> splitPipeline{UI_SPLIT_PIPELINE != 0};
+    SemaphoreHandle_t inputStageMutex = nullptr; // Held while a task runs the input stage
+    InputHandoff inputHandoff;
+
+    // Input stage intervals (written by Core 1, sampled and reset by Core 0)
+    portMUX_TYPE inputStatsMux = portMUX_INITIALIZER_UNLOCKED;
+    InputJitter inputJitter;
+    int64_t lastInputSampleUs = 0;
 
     // Performance monitoring
     uint32_t coordinationCycles = 0;
     uint32_t eventsProcessed = 0;
     uint32_t lastHealthCheck = 0;
 
+    // UI frame timing (written by Core 1, sampled and reset by Core 0)
+    portMUX_TYPE frameStatsMux = portMUX_INITIALIZER_UNLOCKED;
+    uint32_t frameTimeTotalUs = 0;
+    uint32_t frameTimeMaxUs = 0;
+    uint32_t frameCount = 0;
+
+    // Most recent event types processed on Core 0 (newest first)
+    uint8_t recentEvents[HEALTH_LOG_EVENT_HISTORY] = {};
+
     // FreeRTOS task functions
     static void uiTaskFunction(void *param);
+    static void inputTaskFunction(void *param);
     void runUITask();
+    void runInputTask();
+    void runInputStage();
+    void drainLocalInput();
+    void dispatchEncoderEvent(const Event &event);
+    void printUiTiming();
 
     // State machine handlers
     void handleBootingState();
@@ -142,8 +184,13 @@ namespace CloudMouse
     void handleEncoderClick(const Event &event);
     void handleEncoderLongPress(const Event &event);
 
+    // Screen capture packets to Serial (between log lines)
+    void drainCapture();
+
     // System health monitoring
     void checkHealth();
+    void recordFrameTime(uint32_t frameUs);
+    void recordHealthSnapshot(uint32_t freeHeap, uint32_t minFreeHeap);
   };
 
 } // namespace CloudMouse
\ No newline at end of file
@@ -110,6 +110,98 @@ enum class EventType {
      * Usage: Mode transitions, error recovery, screen cleaning
      */
     DISPLAY_CLEAR,
+
+    /**
+     * Run display render benchmark on the UI task
+     * value: Number of iterations (0 = default)
+     * Usage: Serial diagnostics, flush pipeline performance comparison
+     */
+    DISPLAY_BENCHMARK,
+
+    /**
+     * Sweep LVGL buffer placements and band heights on the UI task
+     * value: Number of iterations per configuration (0 = default)
+     * Usage: Serial diagnostics, render buffer trade-off selection
+     */
+    DISPLAY_BUFFER_SWEEP,
+
+    /**
+     * Reallocate LVGL draw buffers on the UI task
+     * value: (DisplayBufferMode << 16) | band height in lines
+     * Usage: Runtime buffer strategy selection
+     */
+    DISPLAY_BUFFER_CONFIG,
+
+    /**
+     * Print per-screen render analytics on the UI task
+     * value: 1 = reset counters after printing
+     * Usage: Serial diagnostics, over-invalidation hunting
+     */
+    DISPLAY_RENDER_STATS,
+
+    /**
+     * Toggle on-screen outline of redrawn rectangles
+     * value: 1 = on, 0 = off
+     * Usage: Visual debugging of invalidation behaviour
+     */
+    DISPLAY_REDRAW_OVERLAY,
+
+    /**
+     * Print screen registry residency and LVGL heap usage per screen
+     * Usage: Serial diagnostics, LVGL memory budgeting
+     */
+    DISPLAY_SCREEN_STATS,
+
+    /**
+     * Benchmark glyph rendering from flash vs. the RAM font cache
+     * value: number of full redraws per mode
+     * Usage: Serial diagnostics, font cache tuning
+     */
+    DISPLAY_FONT_BENCHMARK,
+
+    /**
+     * Print QR cache contents and encode / render / bitmap-hit timings
+     * Usage: Serial diagnostics, QR cache tuning
+     */
+    DISPLAY_QR_STATS,
+
+    /**
+     * Compare per-object local styles with shared UiTheme styles
+     * value: number of full redraws per mode
+     * Usage: Serial diagnostics, style/heap tuning
+     */
+    DISPLAY_STYLE_BENCHMARK,
+
+    /**
+     * Show the virtualised list demo screen
+     * value: number of items (default 1000)
+     * Usage: Serial diagnostics, VirtualList scrolling and memory checks
+     */
+    DISPLAY_LIST_DEMO,
+
+    /**
+     * Show or hide the on-device performance HUD
+     * value: 1 = show, 0 = hide, -1 = toggle
+     * Usage: Ultra-long press, serial "display hud"
+     */
+    DISPLAY_PERF_HUD,
+
+    /**
+     * Capture flushed display bands (see ScreenCapture)
+     * value: 0 = one screenshot, > 0 = stream at up to value fps, < 0 = stop
+     * stringData: "http" / "ws" to hand packets to the web server / display mirror
+     *             instead of Serial
+     * Usage: Serial "display capture" / "display stream", HTTP "/capture", mirror viewer
+     */
+    DISPLAY_CAPTURE,
+
+    /**
+     * Select the LVGL render format (see DisplayColorMode)
+     * value: 0 = RGB565, 1 = indexed L8 + palette LUT, < 0 = benchmark both
+     *        with -value full redraws per configuration
+     * Usage: Serial "display color rgb565|indexed|bench"
+     */
+    DISPLAY_COLOR_MODE,
     
     // ========================================================================
     // WIFI UI FEEDBACK EVENTS
@@ -0,0 +1,204 @@
+/**
+ * CloudMouse SDK - Reboot-Persistent Health Log Implementation
+ *
+ * The ring lives in RTC slow memory (RTC_NOINIT_ATTR), which the bootloader does not
+ * touch on soft resets. After a cold power-on the memory holds random data, so every
+ * boot validates a magic word and a checksum before trusting the contents.
+ */
+
+#include "./HealthLog.h"
+
+namespace CloudMouse
+{
+    // ============================================================================
+    // RTC-RETAINED STORAGE
+    // ============================================================================
+
+    namespace
+    {
+        const uint32_t HEALTH_LOG_MAGIC = 0x484C4F47; // "HLOG"
+
+        struct HealthLogStorage
+        {
+            uint32_t magic;
+            uint32_t bootCount;
+            uint16_t head;  // Next write index
+            uint16_t count; // Valid entries (<= HEALTH_LOG_CAPACITY)
+            uint32_t checksum;
+            HealthSnapshot entries[HEALTH_LOG_CAPACITY];
+        };
+
+        RTC_NOINIT_ATTR HealthLogStorage rtcLog;
+
+        // FNV-1a over everything except the checksum field itself
+        uint32_t computeChecksum(const HealthLogStorage &log)
+        {
+            uint32_t hash = 2166136261u;
+            auto mix = [&hash](const void *data, size_t len)
+            {
+                const uint8_t *bytes = static_cast<const uint8_t *>(data);
+                for (size_t i = 0; i < len; i++)
+                {
+                    hash ^= bytes[i];
+                    hash *= 16777619u;
+                }
+            };
+
+            mix(&log.magic, sizeof(log.magic));
+            mix(&log.bootCount, sizeof(log.bootCount));
+            mix(&log.head, sizeof(log.head));
+            mix(&log.count, sizeof(log.count));
+            mix(log.entries, sizeof(log.entries));
+            return hash;
+        }
+    }
+
+    // ============================================================================
+    // LIFECYCLE
+    // ============================================================================
+
+    void HealthLog::begin()
+    {
+        if (started)
+        {
+            return;
+        }
+        started = true;
+
+        resetReason = esp_reset_reason();
+
+        bool valid = rtcLog.magic == HEALTH_LOG_MAGIC &&
+                     rtcLog.head < HEALTH_LOG_CAPACITY &&
+                     rtcLog.count <= HEALTH_LOG_CAPACITY &&
+                     rtcLog.checksum == computeChecksum(rtcLog);
+
+        if (!valid)
+        {
+            // Cold boot or corrupted RTC memory - start fresh
+            memset(&rtcLog, 0, sizeof(rtcLog));
+            rtcLog.magic = HEALTH_LOG_MAGIC;
+        }
+
+        rtcLog.bootCount++;
+        seal();
+
+        Serial.printf("🩺 HealthLog: boot #%u, reset reason: %s, %u retained snapshot(s)\n",
+                      rtcLog.bootCount, resetReasonName(resetReason), rtcLog.count);
+
+        if (rtcLog.count > 0)
+        {
+            dump(true);
+        }
+    }
+
+    void HealthLog::record(HealthSnapshot snapshot)
+    {
+        if (!started)
+        {
+            return;
+        }
+
+        snapshot.bootCount = rtcLog.bootCount;
+        snapshot.resetReason = (uint8_t)resetReason;
+
+        rtcLog.entries[rtcLog.head] = snapshot;
+        rtcLog.head = (rtcLog.head + 1) % HEALTH_LOG_CAPACITY;
+        if (rtcLog.count < HEALTH_LOG_CAPACITY)
+        {
+            rtcLog.count++;
+        }
+
+        seal();
+    }
+
+    void HealthLog::clear()
+    {
+        rtcLog.head = 0;
+        rtcLog.count = 0;
+        memset(rtcLog.entries, 0, sizeof(rtcLog.entries));
+        seal();
+    }
+
+    void HealthLog::seal()
+    {
+        rtcLog.checksum = computeChecksum(rtcLog);
+    }
+
+    // ============================================================================
+    // REPORTING
+    // ============================================================================
+
+    void HealthLog::dump(bool previousBootsOnly) const
+    {
+        Serial.println("\n🩺 HEALTH_LOG_START");
+        Serial.println("  boot  reset       uptime_s  heap    min     largest psram    lv_int  lv_psram  frame_avg/max_us  q_ui/q_core  state  events");
+
+        // Oldest entry sits at head when the ring is full, at index 0 otherwise
+        uint16_t start = rtcLog.count < HEALTH_LOG_CAPACITY ? 0 : rtcLog.head;
+
+        for (uint16_t i = 0; i < rtcLog.count; i++)
+        {
+            const HealthSnapshot &s = rtcLog.entries[(start + i) % HEALTH_LOG_CAPACITY];
+
+            if (previousBootsOnly && s.bootCount == rtcLog.bootCount)
+            {
+                continue;
+            }
+
+            Serial.printf("  %-5u %-11s %-9u %-7u %-7u %-7u %-8u %-7u %-9u %5u/%-10u %u/%-9u %-6u",
+                          s.bootCount, resetReasonName((esp_reset_reason_t)s.resetReason),
+                          s.uptimeMs / 1000, s.freeHeap, s.minFreeHeap, s.largestBlock, s.freePsram,
+                          s.lvglInternal, s.lvglPsram,
+                          s.frameTimeAvgUs, s.frameTimeMaxUs, s.uiQueueDepth, s.mainQueueDepth,
+                          s.systemState);
+
+            for (uint8_t e = 0; e < HEALTH_LOG_EVENT_HISTORY; e++)
+            {
+                Serial.printf(e == 0 ? "%u" : ",%u", s.lastEvents[e]);
+            }
+            Serial.println();
+        }
+
+        Serial.println("🩺 HEALTH_LOG_END\n");
+    }
+
+    uint32_t HealthLog::getBootCount() const
+    {
+        return started ? rtcLog.bootCount : 0;
+    }
+
+    uint32_t HealthLog::getCount() const
+    {
+        return started ? rtcLog.count : 0;
+    }
+
+    const char *HealthLog::resetReasonName(esp_reset_reason_t reason)
+    {
+        switch (reason)
+        {
+        case ESP_RST_POWERON:
+            return "power-on";
+        case ESP_RST_EXT:
+            return "external";
+        case ESP_RST_SW:
+            return "software";
+        case ESP_RST_PANIC:
+            return "panic";
+        case ESP_RST_INT_WDT:
+            return "int-wdt";
+        case ESP_RST_TASK_WDT:
+            return "task-wdt";
+        case ESP_RST_WDT:
+            return "wdt";
+        case ESP_RST_DEEPSLEEP:
+            return "deepsleep";
+        case ESP_RST_BROWNOUT:
+            return "brownout";
+        case ESP_RST_SDIO:
+            return "sdio";
+        default:
+            return "unknown";
+        }
+    }
+
+} // namespace CloudMouse
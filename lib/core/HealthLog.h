@@ -0,0 +1,119 @@
+/**
+ * CloudMouse SDK - Reboot-Persistent Health Log
+ *
+ * Keeps a ring of the most recent system health snapshots in RTC slow memory so that
+ * post-mortem performance context survives soft resets (watchdog, panic, ESP.restart(),
+ * brownout). The ring is validated on boot, dumped to Serial and then appended to.
+ *
+ * Features:
+ * - Fixed-size ring buffer placed with RTC_NOINIT_ATTR (not cleared on soft reset)
+ * - Magic + checksum validation to discard garbage after a cold power-on
+ * - Boot counter and reset reason recorded alongside every snapshot
+ * - Zero heap usage, constant-time record operation
+ *
+ * Memory Layout:
+ * - Header: 16 bytes (magic, boot counter, ring head/count, checksum)
+ * - Snapshot: 44 bytes × HEALTH_LOG_CAPACITY entries (~720 bytes total)
+ *
+ * Limitations:
+ * - Contents are lost on power loss or when the chip enters deep sleep with RTC off
+ * - Not thread-safe: record() must be called from a single task (Core 0 health check)
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <esp_system.h>
+
+// Number of snapshots retained across reboots (one per health check, every 5s)
+#define HEALTH_LOG_CAPACITY 16
+
+// Number of most recent event types stored inside each snapshot
+#define HEALTH_LOG_EVENT_HISTORY 4
+
+namespace CloudMouse
+{
+    /**
+     * Single health sample captured by Core::checkHealth()
+     * Packed into fixed-width fields to keep the RTC footprint small
+     */
+    struct HealthSnapshot
+    {
+        uint32_t bootCount;      // Boot number this sample belongs to
+        uint32_t uptimeMs;       // millis() at capture time
+        uint32_t freeHeap;       // Free internal heap (bytes)
+        uint32_t minFreeHeap;    // Lowest free heap since boot (bytes)
+        uint32_t largestBlock;   // Largest allocatable internal block (bytes)
+        uint32_t freePsram;      // Free PSRAM (bytes)
+        uint32_t lvglInternal;   // LVGL heap held in internal RAM (bytes)
+        uint32_t lvglPsram;      // LVGL heap held in PSRAM (bytes)
+        uint16_t frameTimeAvgUs; // Average UI frame work time since last sample (µs, saturated)
+        uint16_t frameTimeMaxUs; // Worst UI frame work time since last sample (µs, saturated)
+        uint8_t uiQueueDepth;    // Core → UI queue depth
+        uint8_t mainQueueDepth;  // UI → Core queue depth
+        uint8_t resetReason;     // esp_reset_reason_t of the boot this sample belongs to
+        uint8_t systemState;     // SystemState at capture time
+        uint8_t lastEvents[HEALTH_LOG_EVENT_HISTORY]; // Most recent EventType values (newest first)
+    };
+
+    /**
+     * Health Log Ring Buffer
+     *
+     * Singleton wrapper around the RTC-retained storage. The storage itself is a
+     * file-scope RTC_NOINIT_ATTR variable; this class only provides the access logic.
+     */
+    class HealthLog
+    {
+    public:
+        static HealthLog &instance()
+        {
+            static HealthLog log;
+            return log;
+        }
+
+        /**
+         * Validate retained data and start a new boot session
+         * Clears the ring after a cold boot or corruption, otherwise keeps history
+         * and increments the boot counter. Call once, early in system initialization.
+         */
+        void begin();
+
+        /**
+         * Append snapshot to the ring (oldest entry is overwritten when full)
+         * bootCount and resetReason are filled in automatically
+         *
+         * @param snapshot Sample to store
+         */
+        void record(HealthSnapshot snapshot);
+
+        /**
+         * Print retained snapshots to Serial, oldest first
+         *
+         * @param previousBootsOnly Only print samples captured before the current boot
+         */
+        void dump(bool previousBootsOnly = false) const;
+
+        /**
+         * Drop all retained snapshots (boot counter is preserved)
+         */
+        void clear();
+
+        // Status queries
+        uint32_t getBootCount() const;
+        uint32_t getCount() const;
+        esp_reset_reason_t getResetReason() const { return resetReason; }
+        static const char *resetReasonName(esp_reset_reason_t reason);
+
+    private:
+        HealthLog() = default;
+        HealthLog(const HealthLog &) = delete;
+        HealthLog &operator=(const HealthLog &) = delete;
+
+        esp_reset_reason_t resetReason = ESP_RST_UNKNOWN;
+        bool started = false;
+
+        void seal(); // Recompute checksum after modification
+    };
+
+} // namespace CloudMouse
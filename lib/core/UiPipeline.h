@@ -0,0 +1,152 @@
+/**
+ * CloudMouse SDK - Split UI Pipeline (Input Stage / Render Stage)
+ *
+ * The UI used to run as one 30 Hz loop: button debounce, encoder event dispatch,
+ * lv_timer_handler() and dimming in sequence, so a slow frame delayed input events
+ * and a burst of input delayed the frame. The split pipeline runs two tasks on Core 1:
+ *
+ *   Input_Task  (priority 2, every UI_INPUT_INTERVAL_MS)
+ *     encoder->update() (button debounce), press/rotation events to Core 0,
+ *     local feedback -> InputHandoff
+ *   Render_Task (priority 1, every UI_RENDER_INTERVAL_MS)
+ *     InputHandoff -> DisplayManager::processLocalInput(), display->update()
+ *
+ * Rotation itself is sampled by EncoderManager's esp_timer (every
+ * ENCODER_SAMPLE_INTERVAL_US) in both modes; the input stage only turns the
+ * accumulated movement into events. The split keeps that event dispatch and the
+ * button state machine on their period however long LVGL takes. Only the render task
+ * touches LVGL; the input stage reaches it through lock-free hand-offs (EncoderInput
+ * accumulator for LVGL, InputHandoff for screen feedback and the app callback).
+ *
+ * Measurement:
+ * - InputJitter records every input stage interval (event dispatch period) against
+ *   the nominal period; it says nothing about rotation sampling, which the esp_timer
+ *   does independently of the pipeline mode
+ * - "ui pipeline split|serial" switches at runtime (serial = the original single loop),
+ *   "ui timing" prints and resets the figures for A/B runs on heavy screens
+ *
+ * Configuration:
+ * - UI_SPLIT_PIPELINE 0 starts in serial mode
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "Events.h"
+
+#ifndef UI_SPLIT_PIPELINE
+#define UI_SPLIT_PIPELINE 1
+#endif
+
+// Input stage (button debounce + event dispatch) period in split mode (200 Hz)
+#ifndef UI_INPUT_INTERVAL_MS
+#define UI_INPUT_INTERVAL_MS 5
+#endif
+
+// Render stage period, and the single loop period in serial mode (30 Hz)
+#ifndef UI_RENDER_INTERVAL_MS
+#define UI_RENDER_INTERVAL_MS 33
+#endif
+
+// Encoder events buffered between the stages (one render frame holds ~7 input samples)
+#define UI_INPUT_HANDOFF_SIZE 16
+
+namespace CloudMouse
+{
+    /**
+     * Encoder events from the input stage to the render stage
+     *
+     * Single-producer / single-consumer ring; the event payload is type and value
+     * only, which is all encoder events carry.
+     */
+    class InputHandoff
+    {
+    public:
+        /**
+         * Input stage: queue one event
+         *
+         * @return false if the render stage is UI_INPUT_HANDOFF_SIZE events behind
+         */
+        bool push(const Event &event)
+        {
+            const uint32_t h = head.load(std::memory_order_relaxed);
+            if (h - tail.load(std::memory_order_acquire) >= UI_INPUT_HANDOFF_SIZE)
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            Slot &slot = slots[h % UI_INPUT_HANDOFF_SIZE];
+            slot.type = event.type;
+            slot.value = event.value;
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Render stage: take the oldest event
+         *
+         * @return false when empty
+         */
+        bool pop(Event &event)
+        {
+            const uint32_t t = tail.load(std::memory_order_relaxed);
+            if (t == head.load(std::memory_order_acquire)) return false;
+
+            const Slot &slot = slots[t % UI_INPUT_HANDOFF_SIZE];
+            event = Event(slot.type, slot.value);
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        uint32_t getDropped() const { return dropped.load(std::memory_order_relaxed); }
+
+    private:
+        struct Slot
+        {
+            EventType type;
+            int32_t value;
+        };
+
+        Slot slots[UI_INPUT_HANDOFF_SIZE];
+        std::atomic<uint32_t> head{0};
+        std::atomic<uint32_t> tail{0};
+        std::atomic<uint32_t> dropped{0};
+    };
+
+    /**
+     * Input stage (event dispatch) interval statistics
+     *
+     * Jitter is the distance of each interval from the nominal period; an interval of
+     * at least twice the period means a sample slot was missed.
+     */
+    struct InputJitter
+    {
+        uint32_t nominalUs = 0;
+        uint32_t samples = 0;
+        uint64_t intervalTotalUs = 0;
+        uint64_t jitterTotalUs = 0;
+        uint32_t jitterMaxUs = 0;
+        uint32_t intervalMaxUs = 0;
+        uint32_t missed = 0;
+
+        void record(uint32_t intervalUs)
+        {
+            const uint32_t jitter = intervalUs > nominalUs ? intervalUs - nominalUs : nominalUs - intervalUs;
+            samples++;
+            intervalTotalUs += intervalUs;
+            jitterTotalUs += jitter;
+            if (jitter > jitterMaxUs) jitterMaxUs = jitter;
+            if (intervalUs > intervalMaxUs) intervalMaxUs = intervalUs;
+            if (intervalUs >= 2 * nominalUs) missed++;
+        }
+
+        void reset(uint32_t periodUs)
+        {
+            *this = InputJitter();
+            nominalUs = periodUs;
+        }
+    };
+
+} // namespace CloudMouse
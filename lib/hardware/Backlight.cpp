@@ -0,0 +1,279 @@
+/**
+ * CloudMouse SDK - Hardware-Faded Backlight Implementation
+ */
+
+#include "./Backlight.h"
+#include "../utils/Clock.h"
+#include <math.h>
+
+#ifndef CLOUDMOUSE_HOST_BUILD
+#define BACKLIGHT_LEDC_MODE LEDC_LOW_SPEED_MODE
+#define BACKLIGHT_LEDC_CHANNEL LEDC_CHANNEL_7
+#define BACKLIGHT_LEDC_TIMER LEDC_TIMER_3
+#define BACKLIGHT_PWM_FREQ 5000
+
+// Margin over the nominal duration for cores without the fade-end callback
+#define BACKLIGHT_FADE_MARGIN_US 3000
+#endif
+
+namespace CloudMouse::Hardware
+{
+    constexpr BacklightProfile Backlight::FADE_IN;
+    constexpr BacklightProfile Backlight::FADE_OUT;
+
+    Backlight::~Backlight()
+    {
+#ifndef CLOUDMOUSE_HOST_BUILD
+        if (segmentTimer)
+        {
+            esp_timer_stop(segmentTimer);
+            esp_timer_delete(segmentTimer);
+            segmentTimer = nullptr;
+        }
+#endif
+    }
+
+    // ============================================================================
+    // INITIALIZATION
+    // ============================================================================
+
+    bool Backlight::init(int pin)
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            uint32_t duty = (uint32_t)lroundf(powf(i / 255.0f, BACKLIGHT_GAMMA) * DUTY_MAX);
+            gammaTable[i] = (i > 0 && duty == 0) ? 1 : duty; // Keep lowest levels distinguishable from off
+        }
+
+#ifndef CLOUDMOUSE_HOST_BUILD
+        ledc_timer_config_t timerCfg = {};
+        timerCfg.speed_mode = BACKLIGHT_LEDC_MODE;
+        timerCfg.duty_resolution = LEDC_TIMER_13_BIT;
+        timerCfg.timer_num = BACKLIGHT_LEDC_TIMER;
+        timerCfg.freq_hz = BACKLIGHT_PWM_FREQ;
+        timerCfg.clk_cfg = LEDC_AUTO_CLK;
+
+        ledc_channel_config_t channelCfg = {};
+        channelCfg.gpio_num = pin;
+        channelCfg.speed_mode = BACKLIGHT_LEDC_MODE;
+        channelCfg.channel = BACKLIGHT_LEDC_CHANNEL;
+        channelCfg.timer_sel = BACKLIGHT_LEDC_TIMER;
+        channelCfg.duty = 0;
+        channelCfg.hpoint = 0;
+
+        if (ledc_timer_config(&timerCfg) != ESP_OK || ledc_channel_config(&channelCfg) != ESP_OK)
+        {
+            Serial.println("❌ Backlight: LEDC configuration failed");
+            return false;
+        }
+
+        // Already installed by another LEDC user is fine
+        esp_err_t err = ledc_fade_func_install(0);
+        if (err != ESP_OK && err != ESP_ERR_INVALID_STATE)
+        {
+            Serial.println("❌ Backlight: LEDC fade service unavailable");
+            return false;
+        }
+
+        esp_timer_create_args_t timerArgs = {};
+        timerArgs.callback = segmentTimerCb;
+        timerArgs.arg = this;
+        timerArgs.name = "backlight";
+        if (esp_timer_create(&timerArgs, &segmentTimer) != ESP_OK)
+        {
+            Serial.println("❌ Backlight: fade timer creation failed");
+            return false;
+        }
+
+#if BACKLIGHT_HAS_FADE_CB
+        ledc_cbs_t callbacks = {};
+        callbacks.fade_cb = fadeEndCb;
+        ledc_cb_register(BACKLIGHT_LEDC_MODE, BACKLIGHT_LEDC_CHANNEL, &callbacks, this);
+#endif
+
+        Serial.printf("✅ Backlight: LEDC ch %d, %d Hz, 13-bit, gamma %.1f\n",
+                      (int)BACKLIGHT_LEDC_CHANNEL, BACKLIGHT_PWM_FREQ, BACKLIGHT_GAMMA);
+#else
+        (void)pin;
+#endif
+
+        ready = true;
+        return true;
+    }
+
+    // ============================================================================
+    // LEVEL CONTROL
+    // ============================================================================
+
+    void Backlight::setLevel(uint8_t value)
+    {
+        if (!ready) return;
+
+        portENTER_CRITICAL(&planMux);
+        target = value;
+        segmentsLeft = 0;
+        jumpPending = true;
+        generation++;
+        portEXIT_CRITICAL(&planMux);
+
+        schedule();
+    }
+
+    void Backlight::fadeTo(uint8_t value, const BacklightProfile &profile)
+    {
+        if (!ready || value == target) return;
+
+        if (profile.durationMs == 0 || profile.segments == 0)
+        {
+            setLevel(value);
+            return;
+        }
+
+        portENTER_CRITICAL(&planMux);
+        fadeFrom = level;
+        target = value;
+        segments = profile.segments;
+        segmentsLeft = profile.segments;
+        jumpPending = false;
+        segmentMs = profile.durationMs / profile.segments > 0 ? profile.durationMs / profile.segments : 1;
+        generation++;
+        portEXIT_CRITICAL(&planMux);
+
+        schedule();
+    }
+
+    // ============================================================================
+    // FADE ENGINE
+    // ============================================================================
+
+    void Backlight::schedule()
+    {
+#ifndef CLOUDMOUSE_HOST_BUILD
+        // Hand the new plan to the timer task; a callback already running finishes its
+        // LEDC call first and then sees the new generation
+        esp_timer_stop(segmentTimer);
+        esp_timer_start_once(segmentTimer, 0);
+#else
+        // Host: no PWM hardware, land on the target immediately
+        runPlan();
+#endif
+    }
+
+    void Backlight::runPlan()
+    {
+#ifndef CLOUDMOUSE_HOST_BUILD
+        portENTER_CRITICAL(&planMux);
+        const uint32_t planGeneration = generation;
+        portEXIT_CRITICAL(&planMux);
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+        // New plan: cut the running fade short and continue from where it stopped
+        if (planGeneration != appliedGeneration && hwFading)
+        {
+            ledc_fade_stop(BACKLIGHT_LEDC_MODE, BACKLIGHT_LEDC_CHANNEL);
+            hwFading = false;
+        }
+#endif
+        appliedGeneration = planGeneration;
+
+        // Older IDF: starting a fade or a duty update waits for the running fade, so
+        // poll instead of blocking the esp_timer task
+        if (hardwareBusy())
+        {
+            esp_timer_start_once(segmentTimer, BACKLIGHT_FADE_POLL_US);
+            return;
+        }
+
+        portENTER_CRITICAL(&planMux);
+        if (planGeneration != generation || (!jumpPending && segmentsLeft == 0))
+        {
+            // Superseded while polling (schedule() re-armed the timer) or nothing to do
+            portEXIT_CRITICAL(&planMux);
+            return;
+        }
+
+        const bool jump = jumpPending;
+        uint8_t next = target;
+        if (!jump)
+        {
+            const uint8_t index = segments - segmentsLeft;
+            next = fadeFrom + ((int)target - fadeFrom) * (index + 1) / segments;
+            segmentsLeft = segmentsLeft - 1;
+        }
+        jumpPending = false;
+        level = next;
+        const bool more = segmentsLeft > 0;
+        const uint32_t durationMs = segmentMs;
+        portEXIT_CRITICAL(&planMux);
+
+        if (jump)
+        {
+            writeDuty(gammaTable[next]);
+        }
+        else
+        {
+            // Linear in duty between two points of the gamma curve
+            hwFading = true;
+            hwFadeEndUs = Utils::Clock::nowUs() + (int64_t)durationMs * 1000 + BACKLIGHT_FADE_MARGIN_US;
+            ledc_set_fade_time_and_start(BACKLIGHT_LEDC_MODE, BACKLIGHT_LEDC_CHANNEL,
+                                         gammaTable[next], durationMs, LEDC_FADE_NO_WAIT);
+        }
+
+        portENTER_CRITICAL(&planMux);
+        const bool rearm = more && planGeneration == generation;
+        portEXIT_CRITICAL(&planMux);
+
+        if (rearm)
+        {
+            esp_timer_start_once(segmentTimer, (uint64_t)durationMs * 1000);
+        }
+#else
+        portENTER_CRITICAL(&planMux);
+        level = target;
+        segmentsLeft = 0;
+        jumpPending = false;
+        portEXIT_CRITICAL(&planMux);
+#endif
+    }
+
+    bool Backlight::hardwareBusy()
+    {
+        if (!hwFading) return false;
+#if defined(CLOUDMOUSE_HOST_BUILD) || BACKLIGHT_HAS_FADE_CB
+        return true; // Cleared by fadeEndCb
+#else
+        if (Utils::Clock::nowUs() < hwFadeEndUs) return true;
+        hwFading = false;
+        return false;
+#endif
+    }
+
+    void Backlight::writeDuty(uint32_t duty)
+    {
+#ifndef CLOUDMOUSE_HOST_BUILD
+        ledc_set_duty_and_update(BACKLIGHT_LEDC_MODE, BACKLIGHT_LEDC_CHANNEL, duty, 0);
+#else
+        (void)duty;
+#endif
+    }
+
+#ifndef CLOUDMOUSE_HOST_BUILD
+    void Backlight::segmentTimerCb(void *arg)
+    {
+        // esp_timer task context: the only place LEDC duty changes after init
+        ((Backlight *)arg)->runPlan();
+    }
+
+#if BACKLIGHT_HAS_FADE_CB
+    bool IRAM_ATTR Backlight::fadeEndCb(const ledc_cb_param_t *param, void *arg)
+    {
+        if (param->event == LEDC_FADE_END_EVT)
+        {
+            ((Backlight *)arg)->hwFading = false;
+        }
+        return false;
+    }
+#endif
+#endif
+
+} // namespace CloudMouse::Hardware
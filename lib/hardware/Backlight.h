@@ -0,0 +1,162 @@
+/**
+ * CloudMouse SDK - Hardware-Faded Backlight
+ *
+ * Drives the panel backlight through the LEDC peripheral and lets the hardware fade
+ * engine perform transitions, so dimming no longer runs on the UI loop: a fade costs a
+ * handful of timer callbacks in total instead of a setBrightness() call every few
+ * frames.
+ *
+ * Perceptual Levels:
+ * - Levels 0-255 are mapped to duty through a gamma curve (BACKLIGHT_GAMMA), so equal
+ *   level steps look like equal brightness steps
+ * - LEDC fades are linear in duty; a fade is split into BacklightProfile::segments
+ *   linear hardware fades along the curve, chained from an esp_timer callback
+ *
+ * Hardware:
+ * - Pin TFT_BL, LEDC low-speed channel 7 / timer 3, 5 kHz, 13-bit duty
+ *   (same channel and frequency LovyanGFX used before)
+ *
+ * Host Builds:
+ * - No LEDC; fades complete immediately so scripts see the target level
+ *
+ * Thread Safety:
+ * - fadeTo()/setLevel() from the UI task; they only post a new plan under a spinlock
+ *   and arm the timer, so every LEDC call runs on the esp_timer task
+ * - A plan carries a generation number; a callback already running for an older plan
+ *   does not re-arm the timer
+ * - A segment never starts while the previous hardware fade is still running (the
+ *   callback re-polls instead), so ledc_set_fade_time_and_start() does not block the
+ *   shared esp_timer task on IDF 4.x, which has no ledc_fade_stop()
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+#ifndef CLOUDMOUSE_HOST_BUILD
+#include <driver/ledc.h>
+#include <esp_idf_version.h>
+#include <esp_timer.h>
+
+// Fade-end interrupt callback (IDF 4.4+); older cores fall back to the fade duration
+#define BACKLIGHT_HAS_FADE_CB (ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 4, 0))
+#endif
+
+#ifndef BACKLIGHT_GAMMA
+#define BACKLIGHT_GAMMA 2.2f
+#endif
+
+// Default transitions (total duration in ms, linear hardware segments)
+#ifndef BACKLIGHT_FADE_IN_MS
+#define BACKLIGHT_FADE_IN_MS 200
+#endif
+
+#ifndef BACKLIGHT_FADE_OUT_MS
+#define BACKLIGHT_FADE_OUT_MS 1500
+#endif
+
+#ifndef BACKLIGHT_FADE_SEGMENTS
+#define BACKLIGHT_FADE_SEGMENTS 6
+#endif
+
+// Re-check interval while waiting for a running hardware fade to end
+#ifndef BACKLIGHT_FADE_POLL_US
+#define BACKLIGHT_FADE_POLL_US 2000
+#endif
+
+namespace CloudMouse::Hardware
+{
+    /**
+     * Fade shape: total duration split into linear hardware segments
+     */
+    struct BacklightProfile
+    {
+        uint16_t durationMs;
+        uint8_t segments;
+    };
+
+    class Backlight
+    {
+    public:
+        static constexpr BacklightProfile FADE_IN = {BACKLIGHT_FADE_IN_MS, BACKLIGHT_FADE_SEGMENTS};
+        static constexpr BacklightProfile FADE_OUT = {BACKLIGHT_FADE_OUT_MS, BACKLIGHT_FADE_SEGMENTS};
+
+        ~Backlight();
+
+        /**
+         * Configure LEDC and the fade service, backlight off
+         *
+         * @param pin Backlight GPIO
+         * @return true if the hardware is ready
+         */
+        bool init(int pin);
+
+        /**
+         * Jump to a level without fading
+         */
+        void setLevel(uint8_t level);
+
+        /**
+         * Fade from the current level to a new one
+         * A running fade is cancelled and the new one starts from where it stopped.
+         *
+         * @param level Perceptual target level (0-255)
+         * @param profile Duration and segment count
+         */
+        void fadeTo(uint8_t level, const BacklightProfile &profile);
+
+        /**
+         * Level the backlight is at or fading towards
+         */
+        uint8_t getTarget() const { return target; }
+
+        /**
+         * Level reached by the last started segment
+         */
+        uint8_t getLevel() const { return level; }
+
+        bool isFading() const { return segmentsLeft > 0 || jumpPending || hwFading; }
+
+        /**
+         * Gamma-corrected duty for a perceptual level (13-bit)
+         */
+        uint32_t dutyFor(uint8_t level) const { return gammaTable[level]; }
+
+    private:
+        static const uint32_t DUTY_MAX = (1 << 13) - 1;
+
+        uint16_t gammaTable[256] = {};
+        bool ready = false;
+
+        // Plan shared between the UI task and the timer callback, guarded by planMux
+        portMUX_TYPE planMux = portMUX_INITIALIZER_UNLOCKED;
+        volatile uint8_t level = 0;
+        uint8_t target = 0;
+        uint8_t fadeFrom = 0;
+        uint8_t segments = 0;
+        volatile uint8_t segmentsLeft = 0;
+        volatile bool jumpPending = false;
+        uint32_t segmentMs = 0;
+        uint32_t generation = 0;
+
+        // Hardware fade state, timer task (and fade-end ISR) only
+        volatile bool hwFading = false;
+        int64_t hwFadeEndUs = 0;
+        uint32_t appliedGeneration = 0;
+
+#ifndef CLOUDMOUSE_HOST_BUILD
+        esp_timer_handle_t segmentTimer = nullptr;
+        static void segmentTimerCb(void *arg);
+#if BACKLIGHT_HAS_FADE_CB
+        static bool fadeEndCb(const ledc_cb_param_t *param, void *arg);
+#endif
+#endif
+
+        void schedule();
+        void runPlan();
+        bool hardwareBusy();
+        void writeDuty(uint32_t duty);
+    };
+
+} // namespace CloudMouse::Hardware
@@ -1,5 +1,8 @@
 #include "./DisplayManager.h"
 #include "../core/EventBus.h"
+#include "../utils/StaticQRCode.h"
+#include "../utils/Clock.h"
+#include "./LvglAllocator.h"
 
 namespace CloudMouse::Hardware
 {
@@ -9,8 +12,11 @@ namespace CloudMouse::Hardware
     // LVGL: static variables definition for double buffer
     // ============================================================================
 
-    lv_color_t *DisplayManager::buf1 = nullptr;
-    lv_color_t *DisplayManager::buf2 = nullptr;
+    uint8_t *DisplayManager::buf1 = nullptr;
+    uint8_t *DisplayManager::buf2 = nullptr;
+
+    // Setup portal URL is constant: encoded by the compiler, stored in flash
+    static constexpr auto WIFI_CONFIG_QR = Utils::makeStaticQR(WIFI_CONFIG_SERVICE);
 
     // ============================================================================
     // CONSTRUCTOR AND DESTRUCTOR IMPLEMENTATION
@@ -20,21 +26,19 @@ namespace CloudMouse::Hardware
 
     DisplayManager::~DisplayManager()
     {
-        if (buf1)
-        {
-            free(buf1); 
-            buf1 = nullptr;
-        }
-        if (buf2)
+        releaseBuffers();
+
+        for (uint8_t *&chunk : staging)
         {
-            free(buf2);
-            buf2 = nullptr;
+            if (chunk)
+            {
+                free(chunk);
+                chunk = nullptr;
+            }
         }
 
         if (indev) lv_indev_delete(indev);
         if (disp) lv_display_delete(disp);
-        
-        lvgl_ticker.detach(); 
 
         lv_deinit();
     }
@@ -48,30 +52,15 @@ namespace CloudMouse::Hardware
         Serial.println("🖥️ Initializing DisplayManager con LVGL v9...");
 
         display.init();
-        display.setBrightness(200);
+#ifdef CLOUDMOUSE_HOST_BUILD
+        backlight.init(-1);
+#else
+        backlight.init(TFT_BL);
+#endif
 
         lv_init();
-        lvgl_ticker.attach_ms(4, lv_tick_task);
-
-        const size_t bufSize = 480 * 32; 
-        buf1 = (lv_color_t *)ps_malloc(sizeof(lv_color_t) * bufSize);
-        buf2 = (lv_color_t *)ps_malloc(sizeof(lv_color_t) * bufSize);
-
-        if (!buf1 || !buf2)
-        {
-            Serial.println("❌ LVGL in PSRAM buffer failed!");
-            return;
-        }
-        Serial.printf("✅ Buffer LVGL allocated in PSRAM (2x %d bytes)\n", sizeof(lv_color_t) * bufSize);
-
-
-        // Flushing PSRAM buffers to prevent residual corrupted data on power disconnection
-        const size_t totalBufBytes = sizeof(lv_color_t) * bufSize;
-
-        memset(buf1, 0, totalBufBytes);
-        memset(buf2, 0, totalBufBytes);
-
-        Serial.println("✅ PSRAM Buffers flushed.");
+        LvglAllocator::installDrawBufHandlers(); // Layers, masks and glyphs render from internal RAM
+        lv_tick_set_cb(Utils::Clock::lvglTick); // LVGL reads the shared time base, no tick ISR
 
         // LVGL display driver init (v9)
         disp = lv_display_create(getWidth(), getHeight());
@@ -80,8 +69,28 @@ namespace CloudMouse::Hardware
              return;
         }
         lv_display_set_flush_cb(disp, lvgl_flush_cb);
-        lv_display_set_buffers(disp, buf1, buf2, bufSize * sizeof(lv_color_t), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        lv_display_set_flush_wait_cb(disp, lvgl_flush_wait_cb);
         lv_display_set_user_data(disp, this);
+        lv_display_add_event_cb(disp, lvgl_display_event_cb, LV_EVENT_ALL, this);
+
+        // Indexed mode expands through the staging buffers, so they come first
+        allocateStaging();
+        for (uint8_t i = 0; i < UiTheme::PALETTE_SIZE; i++)
+        {
+            palette.add(UiTheme::PALETTE[i]);
+        }
+        if (colorMode == DisplayColorMode::INDEXED && !(staging[0] && staging[1]))
+        {
+            Serial.println("⚠️ Indexed colour needs DMA staging buffers - rendering RGB565");
+            colorMode = DisplayColorMode::RGB565;
+        }
+        applyColorFormat();
+
+        if (!configureBuffers(bufferMode, bufferLines))
+        {
+            Serial.println("❌ LVGL buffer allocation failed!");
+            return;
+        }
 
         // LVGL input (Encoder) driver init (v9)
         indev = lv_indev_create();
@@ -98,11 +107,16 @@ namespace CloudMouse::Hardware
         lv_group_set_default(encoder_group);
         lv_indev_set_group(indev, encoder_group);
 
+        // Hot large fonts are read from RAM instead of through the flash cache
+        fontTitle = fontCache.add(UI_FONT_TITLE);
+        fontStatus = fontCache.add(UI_FONT_STATUS);
+
         // Create LVGL UI 
         Serial.println("🎨 Creating UI LVGL...");
         createUi();
 
         initialized = true;
+        wakeUp();
         Serial.printf("✅ DisplayManager with LVGL v9 succesfully initialized!\n");
     }
 
@@ -113,43 +127,94 @@ namespace CloudMouse::Hardware
         {
             processEvent(event);
         }
-        lv_timer_handler();
+        // Paused: timers and animations are frozen and nothing reaches the panel
+        // No draw buffers: a reallocation failed and LVGL must not render into freed memory
+        if (buf1 && powerState != DisplayPowerState::PAUSED && powerState != DisplayPowerState::SLEEPING)
+        {
+            capture.prepareFrame(disp);
+            lv_timer_handler();
+            finishFlush();
+        }
         handleDimmer();
     }
 
-    void DisplayManager::handleDimmer() {
-      const unsigned long IDLE_TIMEOUT_MS = 10000; // 10 secondi di inattività
-
-      // Verify IDLE mode
-      if (millis() - lastInteractionTime > IDLE_TIMEOUT_MS) {
-          
-        // check for next step delay
-        if (millis() - lastFadeTime > FADE_OUT_STEP_DELAY_MS) {
-                      
-          // check if target is reached out
-          if (currentBrightness > BRIGHTNESS_IDLE_TARGET) {
-              
-            // calculate new brightness using fade out step
-            currentBrightness = currentBrightness - FADE_OUT_STEP_VALUE;
-            
-            if (currentBrightness < BRIGHTNESS_IDLE_TARGET) {
-                currentBrightness = BRIGHTNESS_IDLE_TARGET;
+    void DisplayManager::handleDimmer()
+    {
+        const unsigned long idleMs = Utils::Clock::nowMs() - lastInteractionTime;
+
+        // Fades run in the LEDC peripheral; only state transitions happen here
+        switch (powerState)
+        {
+        case DisplayPowerState::ACTIVE:
+            if (idleMs > DISPLAY_IDLE_TIMEOUT_MS)
+            {
+                backlight.fadeTo(BRIGHTNESS_IDLE_TARGET, Backlight::FADE_OUT);
+                powerState = DisplayPowerState::DIMMING;
             }
-            
-            // set new brightness
-            display.setBrightness(currentBrightness);
-            
-            // and update fading timer
-            lastFadeTime = millis();
-          }
+            break;
+
+        case DisplayPowerState::DIMMING:
+            if (!backlight.isFading()) pauseRendering();
+            break;
+
+        case DisplayPowerState::PAUSED:
+            if (DISPLAY_SLEEP_TIMEOUT_MS > 0 && idleMs > DISPLAY_SLEEP_TIMEOUT_MS) enterSleep();
+            break;
+
+        case DisplayPowerState::SLEEPING:
+            break;
+        }
+    }
+
+    void DisplayManager::wakeUp()
+    {
+        lastInteractionTime = Utils::Clock::nowMs();
+
+        if (powerState == DisplayPowerState::PAUSED || powerState == DisplayPowerState::SLEEPING)
+        {
+            resumeRendering();
         }
-      }
+
+        if (powerState != DisplayPowerState::ACTIVE || backlight.getTarget() != BRIGHTNESS_UP_TARGET)
+        {
+            backlight.fadeTo(BRIGHTNESS_UP_TARGET, Backlight::FADE_IN);
+            powerState = DisplayPowerState::ACTIVE;
+        }
+    }
+
+    void DisplayManager::pauseRendering()
+    {
+        powerState = DisplayPowerState::PAUSED;
+        pausedSince = Utils::Clock::nowMs();
+        Serial.println("💤 Display idle - rendering paused");
     }
 
-    void DisplayManager::wakeUp() {
-      lastInteractionTime = millis();
-      currentBrightness = BRIGHTNESS_UP_TARGET;
-      display.setBrightness(BRIGHTNESS_UP_TARGET);
+    void DisplayManager::enterSleep()
+    {
+        backlight.setLevel(0);
+#if DISPLAY_PANEL_SLEEP
+        display.sleep(); // ILI9488 SLPIN: GRAM retained, scan and oscillator stopped
+#endif
+        powerState = DisplayPowerState::SLEEPING;
+        Serial.println("💤 Display sleeping - backlight off");
+    }
+
+    void DisplayManager::resumeRendering()
+    {
+        if (powerState == DisplayPowerState::SLEEPING)
+        {
+#if DISPLAY_PANEL_SLEEP
+            display.wakeup(); // SLPOUT
+            delay(5);         // Panel accepts pixel data 5 ms after sleep out
+#endif
+        }
+
+        Serial.printf("☀️ Display resumed after %lu ms paused\n", Utils::Clock::nowMs() - pausedSince);
+
+        // Content changed while paused (and animations moved on) - redraw everything
+        lv_obj_t *active = lv_screen_active();
+        if (active) lv_obj_invalidate(active);
+        powerState = DisplayPowerState::ACTIVE;
     }
 
     // ============================================================================
@@ -163,24 +228,727 @@ namespace CloudMouse::Hardware
 
         uint32_t w = lv_area_get_width(area);
         uint32_t h = lv_area_get_height(area);
+        uint32_t start = micros();
+        self->flushCalls++;
+
+        const bool indexed = self->colorMode == DisplayColorMode::INDEXED;
+        self->renderStats.noteFlush(area);
+        self->renderStats.drawOverlay(area, px_map, indexed);
+        self->capture.captureBand(area, px_map);
+
+        // L8 bands can only reach the panel through the LUT and the staging buffers
+        if (!self->asyncFlush && !indexed)
+        {
+            self->display.pushImage(area->x1, area->y1, w, h, (uint16_t *)px_map);
+            self->flushBusyUs += micros() - start;
+            lv_display_flush_ready(disp);
+            return;
+        }
+
+        // Keep the SPI transaction open across bands so every band goes straight to DMA
+        if (!self->flushTransactionOpen)
+        {
+            self->display.startWrite();
+            self->flushTransactionOpen = true;
+        }
+
+        if (self->staging[0] && self->staging[1])
+        {
+            // Band is fully converted on return - hand it back to LVGL right away
+            self->flushStaged(area, px_map);
+            if (!self->asyncFlush) self->display.waitDMA();
+            self->flushBusyUs += micros() - start;
+            lv_display_flush_ready(disp);
+            return;
+        }
+
+        // Previous band must be fully clocked out before the bus is reused
+        self->display.waitDMA();
+
+        if (self->bufferMode == DisplayBufferMode::HYBRID && self->buf2)
+        {
+            // Hybrid: copy the internal band to PSRAM and release it, so LVGL renders the
+            // next band while DMA reads the copy
+            memcpy(self->buf2, px_map, (size_t)w * h * 2);
+            lv_display_flush_ready(disp);
+            self->display.pushImageDMA(area->x1, area->y1, w, h, (uint16_t *)self->buf2);
+            self->flushBusyUs += micros() - start;
+            return;
+        }
+
+        self->display.pushImageDMA(area->x1, area->y1, w, h, (uint16_t *)px_map);
+        self->flushBusyUs += micros() - start;
+
+        // Flush ready is signalled from lvgl_flush_wait_cb once the transfer completes,
+        // letting LVGL render the next band into the other buffer meanwhile
+    }
+
+    void DisplayManager::allocateStaging()
+    {
+        if (DISPLAY_STAGING_LINES <= 0) return;
+
+        const size_t bytes = PixelConverter::outputSize((size_t)getWidth() * DISPLAY_STAGING_LINES);
+        staging[0] = (uint8_t *)heap_caps_malloc(bytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        staging[1] = (uint8_t *)heap_caps_malloc(bytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+
+        if (!staging[0] || !staging[1])
+        {
+            Serial.println("⚠️ DMA staging buffers unavailable - using LovyanGFX conversion");
+            free(staging[0]);
+            free(staging[1]);
+            staging[0] = staging[1] = nullptr;
+            return;
+        }
+
+        Serial.printf("✅ DMA staging buffers: 2x %d bytes (%d lines)\n", (int)bytes, DISPLAY_STAGING_LINES);
+    }
 
-        self->display.pushImage(area->x1, area->y1, w, h, (uint16_t *)px_map);
+    void DisplayManager::flushStaged(const lv_area_t *area, const uint8_t *px_map)
+    {
+        const int32_t w = lv_area_get_width(area);
+        const int32_t h = lv_area_get_height(area);
+
+        // Narrow areas fit more rows into one staging chunk
+        const int32_t chunkPixels = getWidth() * DISPLAY_STAGING_LINES;
+        const int32_t rowsPerChunk = chunkPixels / w > 0 ? chunkPixels / w : 1;
+
+        for (int32_t row = 0; row < h; row += rowsPerChunk)
+        {
+            const int32_t rows = (h - row) < rowsPerChunk ? (h - row) : rowsPerChunk;
+            uint8_t *chunk = staging[stagingIndex];
+            stagingIndex ^= 1;
+
+            // Convert while the previous chunk (other staging buffer) is still on the wire
+            if (colorMode == DisplayColorMode::INDEXED)
+            {
+                palette.expandRgb666(chunk, px_map + (size_t)row * w, (size_t)rows * w);
+            }
+            else
+            {
+                PixelConverter::rgb565ToRgb666(chunk, (const uint16_t *)px_map + (size_t)row * w, (size_t)rows * w,
+                                               DISPLAY_RGB565_SWAPPED);
+            }
+
+            display.waitDMA();
+            display.pushImageDMA(area->x1, area->y1 + row, w, rows, (const lgfx::bgr888_t *)chunk);
+        }
+    }
+
+    void DisplayManager::lvgl_flush_wait_cb(lv_display_t *disp)
+    {
+        DisplayManager *self = (DisplayManager *)lv_display_get_user_data(disp);
+        if (!self) return;
+
+        // Staged flushes release the band themselves; only raw DMA bands need waiting
+        if (self->flushTransactionOpen && !(self->staging[0] && self->staging[1]))
+        {
+            uint32_t start = micros();
+            self->display.waitDMA();
+            self->flushBusyUs += micros() - start;
+        }
 
         lv_display_flush_ready(disp);
     }
 
+    void DisplayManager::finishFlush()
+    {
+        // Release the bus at end of frame; endWrite() waits for the last band
+        if (flushTransactionOpen)
+        {
+            uint32_t start = micros();
+            display.endWrite();
+            flushBusyUs += micros() - start;
+            flushTransactionOpen = false;
+        }
+
+        if (renderStats.isFrameOpen())
+        {
+            const uint32_t lastIndex = renderStats.getLastFrame().index;
+            renderStats.endFrame((uint8_t)currentScreen, flushBusyUs);
+
+            // Cycles without a flush are not frames; only count real ones
+            if (renderStats.getLastFrame().index != lastIndex)
+            {
+                perfHud.noteFrame(renderStats.getLastFrame().totalUs);
+            }
+        }
+
+        capture.endFrame();
+    }
+
+    void DisplayManager::lvgl_display_event_cb(lv_event_t *e)
+    {
+        DisplayManager *self = (DisplayManager *)lv_event_get_user_data(e);
+        if (!self) return;
+
+        switch (lv_event_get_code(e))
+        {
+        case LV_EVENT_INVALIDATE_AREA:
+            self->renderStats.noteInvalidation((const lv_area_t *)lv_event_get_param(e));
+            break;
+
+        case LV_EVENT_REFR_START:
+            self->renderStats.beginFrame(self->flushBusyUs);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    void DisplayManager::printRenderStats(bool reset)
+    {
+        renderStats.print(screens.getNames(), screens.getCount(), getWidth() * getHeight());
+        Serial.printf("🎮 Encoder-to-LVGL latency (%s path): %lu samples, avg=%lu us, max=%lu us\n",
+                      ENCODER_DIRECT_INPUT ? "direct" : "queued", (unsigned long)inputLatencySamples,
+                      (unsigned long)(inputLatencySamples ? inputLatencyTotalUs / inputLatencySamples : 0),
+                      (unsigned long)inputLatencyMaxUs);
+
+        if (reset)
+        {
+            renderStats.reset();
+            inputLatencySamples = 0;
+            inputLatencyTotalUs = 0;
+            inputLatencyMaxUs = 0;
+        }
+    }
+
+    void DisplayManager::setRedrawOverlay(bool enabled)
+    {
+        renderStats.setOverlay(enabled);
+        Serial.printf("🖥️ Redraw overlay: %s\n", enabled ? "on" : "off");
+
+        // Repaint so stale outlines disappear when switching off
+        lv_obj_invalidate(lv_screen_active());
+    }
+
+    void DisplayManager::setAsyncFlush(bool enabled)
+    {
+        finishFlush();
+        asyncFlush = enabled;
+        Serial.printf("🖥️ Display flush mode: %s\n", enabled ? "async DMA" : "blocking");
+    }
+
+    // ============================================================================
+    // LVGL DRAW BUFFER MANAGEMENT
+    // ============================================================================
+
+    uint8_t *DisplayManager::allocateBuffer(size_t bytes, bool internal)
+    {
+        if (internal)
+        {
+            return (uint8_t *)heap_caps_malloc(bytes, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        }
+        return (uint8_t *)ps_malloc(bytes);
+    }
+
+    void DisplayManager::releaseBuffers()
+    {
+        if (buf1)
+        {
+            free(buf1);
+            buf1 = nullptr;
+        }
+        if (buf2)
+        {
+            free(buf2);
+            buf2 = nullptr;
+        }
+        bufferBytes = 0;
+    }
+
+    bool DisplayManager::allocatePair(DisplayBufferMode mode, uint16_t lines, uint8_t *&first, uint8_t *&second)
+    {
+        const size_t bytes = (size_t)getWidth() * lines * bytesPerPixel();
+        first = allocateBuffer(bytes, mode != DisplayBufferMode::PSRAM);
+
+        // HYBRID: one internal render band; PSRAM flush copy only without DMA staging
+        const bool needSecond = mode != DisplayBufferMode::HYBRID || !(staging[0] && staging[1]);
+        second = needSecond ? allocateBuffer(bytes, mode == DisplayBufferMode::INTERNAL_DMA) : nullptr;
+        if (first && (second || !needSecond)) return true;
+
+        free(first);
+        free(second);
+        first = second = nullptr;
+        return false;
+    }
+
+    bool DisplayManager::configureBuffers(DisplayBufferMode mode, uint16_t lines)
+    {
+        if (!disp) return false;
+        if (lines == 0 || lines > getHeight()) lines = DISPLAY_BUFFER_LINES;
+
+        // No band may be in flight while buffers are swapped
+        finishFlush();
+
+        const DisplayBufferMode previousMode = bufferMode;
+        const uint16_t previousLines = bufferLines;
+        uint8_t *next1 = nullptr;
+        uint8_t *next2 = nullptr;
+
+        // New pair first: LVGL keeps the old pair until lv_display_set_buffers() replaces it
+        bool requested = allocatePair(mode, lines, next1, next2);
+        bool released = false;
+        if (!requested && buf1)
+        {
+            // Both pairs do not fit at once; nothing renders until a pair is installed below
+            releaseBuffers();
+            released = true;
+            requested = allocatePair(mode, lines, next1, next2);
+        }
+
+        bool ok = requested;
+        if (!ok)
+        {
+            Serial.printf("⚠️ LVGL buffers: %s x%d lines unavailable - falling back to PSRAM\n",
+                          bufferModeName(mode), lines);
+            mode = DisplayBufferMode::PSRAM;
+            lines = DISPLAY_BUFFER_LINES;
+            ok = allocatePair(mode, lines, next1, next2);
+        }
+        if (!ok && released)
+        {
+            // Re-install the configuration that was running
+            mode = previousMode;
+            lines = previousLines;
+            ok = allocatePair(mode, lines, next1, next2);
+        }
+        if (!ok)
+        {
+            // Old pair still installed unless it was released: rendering stops in that case
+            Serial.println("❌ LVGL buffers: allocation failed");
+            return false;
+        }
+
+        bufferBytes = (size_t)getWidth() * lines * bytesPerPixel();
+
+        // Clear buffers to prevent residual corrupted data on power disconnection
+        memset(next1, 0, bufferBytes);
+        if (next2) memset(next2, 0, bufferBytes);
+
+        lv_display_set_buffers(disp, next1, renderBuffer2(mode, next2), bufferBytes, LV_DISPLAY_RENDER_MODE_PARTIAL);
+        if (!released)
+        {
+            free(buf1);
+            free(buf2);
+        }
+        buf1 = next1;
+        buf2 = next2;
+        bufferMode = mode;
+        bufferLines = lines;
+
+        if (bufferMode == DisplayBufferMode::HYBRID)
+        {
+            Serial.printf("✅ LVGL buffers: hybrid, %d lines (1x %d bytes internal, %s, flush copy %s)\n",
+                          bufferLines, (int)bufferBytes, colorModeName(colorMode),
+                          buf2 ? "in PSRAM" : "via DMA staging");
+        }
+        else
+        {
+            Serial.printf("✅ LVGL buffers: %s, %d lines (2x %d bytes, %s)\n",
+                          bufferModeName(bufferMode), bufferLines, (int)bufferBytes, colorModeName(colorMode));
+        }
+
+        if (initialized)
+        {
+            lv_obj_invalidate(lv_screen_active());
+        }
+        return requested;
+    }
+
+    const char *DisplayManager::bufferModeName(DisplayBufferMode mode)
+    {
+        switch (mode)
+        {
+        case DisplayBufferMode::INTERNAL_DMA:
+            return "internal";
+        case DisplayBufferMode::HYBRID:
+            return "hybrid";
+        default:
+            return "psram";
+        }
+    }
+
+    // ============================================================================
+    // COLOUR MODE
+    // ============================================================================
+
+    void DisplayManager::applyColorFormat()
+    {
+        const bool indexed = colorMode == DisplayColorMode::INDEXED;
+        lv_display_set_color_format(disp, indexed ? LV_COLOR_FORMAT_L8 : LV_COLOR_FORMAT_RGB565);
+        capture.setIndexedLut(indexed ? palette.getRgb565Lut() : nullptr);
+    }
+
+    bool DisplayManager::setColorMode(DisplayColorMode mode)
+    {
+        if (!disp) return false;
+
+        if (mode == DisplayColorMode::INDEXED && !(staging[0] && staging[1]))
+        {
+            Serial.println("❌ Indexed colour needs the DMA staging buffers (DISPLAY_STAGING_LINES > 0)");
+            return false;
+        }
+
+        // Bands in flight still use the old format
+        finishFlush();
+        const DisplayColorMode previous = colorMode;
+        colorMode = mode;
+        applyColorFormat();
+
+        const bool ok = configureBuffers(bufferMode, bufferLines);
+        if (buf1 && bufferBytes != (size_t)getWidth() * bufferLines * bytesPerPixel())
+        {
+            // No pair for the new format could be allocated: the old pair needs the old format
+            colorMode = previous;
+            applyColorFormat();
+            lv_display_set_buffers(disp, buf1, renderBuffer2(bufferMode, buf2), bufferBytes,
+                                   LV_DISPLAY_RENDER_MODE_PARTIAL);
+            Serial.printf("❌ Colour mode unchanged: %s\n", colorModeName(colorMode));
+            return false;
+        }
+        Serial.printf("🎨 Colour mode: %s\n", colorModeName(colorMode));
+        return ok;
+    }
+
+    const char *DisplayManager::colorModeName(DisplayColorMode mode)
+    {
+        return mode == DisplayColorMode::INDEXED ? "indexed L8" : "RGB565";
+    }
+
+    // ============================================================================
+    // RENDER PIPELINE BENCHMARK
+    // ============================================================================
+
+    uint32_t DisplayManager::measureFullRedraw()
+    {
+        uint32_t start = micros();
+
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(disp);
+        finishFlush();
+
+        return micros() - start;
+    }
+
+    void DisplayManager::runRedrawBenchmark(int iterations)
+    {
+        if (!initialized) return;
+        if (iterations <= 0) iterations = 10;
+
+        const bool previousMode = asyncFlush;
+
+        // ILI9488 over SPI takes 3 bytes per pixel (RGB666)
+        const uint32_t spiBoundUs = (uint64_t)getWidth() * getHeight() * 3 * 8 * 1000000ULL / 40000000ULL;
+
+        Serial.printf("\n⏱️ Full-screen redraw benchmark (%d iterations)\n", iterations);
+        Serial.printf("   SPI bandwidth limit: %lu us/frame\n", (unsigned long)spiBoundUs);
+
+        for (int mode = 0; mode < 2; mode++)
+        {
+            setAsyncFlush(mode == 1);
+            measureFullRedraw(); // warm-up
+
+            uint32_t total = 0, best = UINT32_MAX, worst = 0;
+            for (int i = 0; i < iterations; i++)
+            {
+                uint32_t t = measureFullRedraw();
+                total += t;
+                if (t < best) best = t;
+                if (t > worst) worst = t;
+            }
+
+            uint32_t avg = total / iterations;
+            Serial.printf("   %-8s avg=%lu us  min=%lu us  max=%lu us  (%.1f%% of SPI limit)\n",
+                          mode == 1 ? "async" : "blocking",
+                          (unsigned long)avg, (unsigned long)best, (unsigned long)worst,
+                          avg ? 100.0f * spiBoundUs / avg : 0.0f);
+        }
+
+        setAsyncFlush(previousMode);
+    }
+
+    void DisplayManager::runFontBenchmark(int iterations)
+    {
+        if (!initialized) return;
+        if (iterations <= 0) iterations = 10;
+
+        fontCache.print();
+        Serial.printf("\n⏱️ Font benchmark on '%s' (%d full redraws per mode)\n",
+                      screens.getName((uint8_t)currentScreen), iterations);
+
+        const bool previous = fontCache.isEnabled();
+        uint32_t avgUs[2] = {0, 0};
+
+        for (int mode = 0; mode < 2; mode++)
+        {
+            fontCache.setEnabled(mode == 1);
+            measureFullRedraw(); // warm-up
+
+            uint32_t total = 0;
+            for (int i = 0; i < iterations; i++)
+            {
+                total += measureFullRedraw();
+            }
+            avgUs[mode] = total / iterations;
+
+            Serial.printf("   %-6s glyphs: avg=%lu us\n", mode == 1 ? "RAM" : "flash", (unsigned long)avgUs[mode]);
+        }
+
+        if (avgUs[0])
+        {
+            Serial.printf("   RAM cache saves %ld us per full redraw (%.1f%%)\n",
+                          (long)avgUs[0] - (long)avgUs[1],
+                          100.0f * ((float)avgUs[0] - (float)avgUs[1]) / avgUs[0]);
+        }
+
+        fontCache.setEnabled(previous);
+        lv_obj_invalidate(lv_screen_active());
+    }
+
+    void DisplayManager::runStyleBenchmark(int iterations)
+    {
+        if (!initialized) return;
+        if (iterations <= 0) iterations = 10;
+
+        Serial.printf("\n⏱️ Style benchmark on sample screen (%d full redraws per mode)\n", iterations);
+
+        lv_obj_t *previous = lv_screen_active();
+        const bool wasShared = UiTheme::isShared();
+        uint32_t heapBytes[2] = {0, 0};
+        uint32_t avgUs[2] = {0, 0};
+
+        for (int mode = 0; mode < 2; mode++)
+        {
+            UiTheme::setShared(mode == 1);
+
+            const uint32_t heapBefore = ScreenRegistry::heapUsed();
+            const uint32_t start = micros();
+            lv_obj_t *sample = createStyleSample();
+            const uint32_t buildUs = micros() - start;
+            heapBytes[mode] = ScreenRegistry::heapUsed() - heapBefore;
+
+            lv_screen_load(sample);
+            measureFullRedraw(); // warm-up
+
+            uint32_t total = 0;
+            for (int i = 0; i < iterations; i++)
+            {
+                total += measureFullRedraw();
+            }
+            avgUs[mode] = total / iterations;
+
+            lv_screen_load(previous);
+            lv_obj_delete(sample);
+
+            Serial.printf("   %-6s styles: heap=%lu bytes  build=%lu us  redraw avg=%lu us\n",
+                          mode == 1 ? "shared" : "local", (unsigned long)heapBytes[mode],
+                          (unsigned long)buildUs, (unsigned long)avgUs[mode]);
+        }
+
+        Serial.printf("   Shared styles save %ld bytes LVGL heap and %ld us per full redraw\n",
+                      (long)heapBytes[0] - (long)heapBytes[1], (long)avgUs[0] - (long)avgUs[1]);
+
+        UiTheme::setShared(wasShared);
+        lv_obj_invalidate(lv_screen_active());
+    }
+
+    void DisplayManager::runBufferSweep(int iterations)
+    {
+        if (!initialized) return;
+        if (iterations <= 0) iterations = 5;
+
+        static const uint16_t sweepLines[] = {8, 16, 24, 32, 48, 64, 96};
+        static const DisplayBufferMode sweepModes[] = {
+            DisplayBufferMode::INTERNAL_DMA, DisplayBufferMode::HYBRID, DisplayBufferMode::PSRAM};
+
+        const DisplayBufferMode previousMode = bufferMode;
+        const uint16_t previousLines = bufferLines;
+
+        Serial.printf("\n⏱️ LVGL buffer sweep (%d full redraws each, %s flush)\n",
+                      iterations, asyncFlush ? "async" : "blocking");
+        Serial.println("   (hybrid = LVGL renders into one internal band, PSRAM only holds the flush copy)");
+        Serial.println("   mode      lines  internal_B  psram_B   fps    frame_us  flush_us  flushes");
+
+        for (DisplayBufferMode mode : sweepModes)
+        {
+            for (uint16_t lines : sweepLines)
+            {
+                if (!configureBuffers(mode, lines))
+                {
+                    Serial.printf("   %-9s %-6d skipped (allocation failed)\n", bufferModeName(mode), lines);
+                    continue;
+                }
+
+                measureFullRedraw(); // warm-up
+
+                // Flush counters are monotonic (RenderStats diffs them): measure deltas
+                const uint32_t flushBusyStart = flushBusyUs;
+                const uint32_t flushCallsStart = flushCalls;
+                uint32_t total = 0;
+                for (int i = 0; i < iterations; i++)
+                {
+                    total += measureFullRedraw();
+                }
+                const uint32_t sweepFlushUs = flushBusyUs - flushBusyStart;
+                const uint32_t sweepFlushes = flushCalls - flushCallsStart;
+
+                uint32_t avg = total / iterations;
+                // Hybrid: one internal render band, plus the PSRAM flush copy when allocated
+                size_t internalBytes = bufferBytes * (mode == DisplayBufferMode::INTERNAL_DMA ? 2 : mode == DisplayBufferMode::HYBRID ? 1 : 0);
+                size_t psramBytes = mode == DisplayBufferMode::PSRAM ? bufferBytes * 2
+                                    : mode == DisplayBufferMode::HYBRID && buf2 ? bufferBytes : 0;
+
+                Serial.printf("   %-9s %-6d %-11u %-9u %-6.1f %-9lu %-9lu %lu\n",
+                              bufferModeName(mode), lines, (unsigned)internalBytes, (unsigned)psramBytes,
+                              avg ? 1000000.0f / avg : 0.0f, (unsigned long)avg,
+                              (unsigned long)(sweepFlushUs / iterations),
+                              (unsigned long)(sweepFlushes / iterations));
+            }
+        }
+
+        configureBuffers(previousMode, previousLines);
+    }
+
+    void DisplayManager::runColorBenchmark(int iterations)
+    {
+        if (!initialized) return;
+        if (iterations <= 0) iterations = 10;
+
+        const DisplayColorMode previousColor = colorMode;
+        const DisplayBufferMode previousMode = bufferMode;
+        const uint16_t previousLines = bufferLines;
+        const uint16_t tallLines = previousLines * 2 <= getHeight() ? previousLines * 2 : getHeight();
+
+        // Indexed at the same band height (half the memory) and at twice the height (same memory)
+        struct ColorConfig
+        {
+            DisplayColorMode mode;
+            uint16_t lines;
+        };
+        const ColorConfig configs[] = {
+            {DisplayColorMode::RGB565, previousLines},
+            {DisplayColorMode::INDEXED, previousLines},
+            {DisplayColorMode::INDEXED, tallLines}};
+
+        Serial.printf("\n⏱️ Colour mode benchmark on '%s' (%d full redraws each, %s buffers, %s flush)\n",
+                      screens.getName((uint8_t)currentScreen), iterations, bufferModeName(previousMode),
+                      asyncFlush ? "async" : "blocking");
+        Serial.println("   mode        lines  buffers_B  frame_us  render_us  flush_us  fill_Mpx/s");
+
+        for (const ColorConfig &config : configs)
+        {
+            if (!setColorMode(config.mode) || !configureBuffers(previousMode, config.lines))
+            {
+                Serial.printf("   %-11s %-6d skipped (unavailable)\n", colorModeName(config.mode), config.lines);
+                continue;
+            }
+
+            measureFullRedraw(); // warm-up
+
+            const uint32_t flushBusyStart = flushBusyUs;
+            uint32_t total = 0;
+            for (int i = 0; i < iterations; i++)
+            {
+                total += measureFullRedraw();
+            }
+
+            const uint32_t avg = total / iterations;
+            const uint32_t flushUs = (flushBusyUs - flushBusyStart) / iterations;
+            const uint32_t renderUs = avg > flushUs ? avg - flushUs : 0;
+
+            Serial.printf("   %-11s %-6d %-10u %-9lu %-10lu %-9lu %.2f\n",
+                          colorModeName(config.mode), config.lines, (unsigned)(bufferBytes * 2),
+                          (unsigned long)avg, (unsigned long)renderUs, (unsigned long)flushUs,
+                          renderUs ? (float)getWidth() * getHeight() / renderUs : 0.0f);
+        }
+
+        Serial.println("   Note: indexed matches RGB565 only for flat palette fills; anti-aliased edges blend");
+        Serial.println("   along the luminance ramp (coloured fringes possible) and off-palette colours or");
+        Serial.println("   images snap to the palette colour of the same luminance");
+
+        setColorMode(previousColor);
+        configureBuffers(previousMode, previousLines);
+    }
+
     void DisplayManager::lvgl_encoder_read_cb(lv_indev_t *indev, lv_indev_data_t *data)
     {
         DisplayManager *self = (DisplayManager *)lv_indev_get_user_data(indev); // Corretto
         if (!self) return;
 
-        data->enc_diff = self->encoder_diff;
-        data->state = self->encoder_state;
+        int32_t diff = self->encoder_diff;
+        bool pressed = self->encoder_state == LV_INDEV_STATE_PRESSED;
 
         self->encoder_diff = 0;
-        if (self->encoder_state == LV_INDEV_STATE_PRESSED)
+        self->encoder_state = LV_INDEV_STATE_RELEASED;
+
+        if (self->encoderInput)
+        {
+#if ENCODER_DIRECT_INPUT
+            diff += self->encoderInput->takeDiff();
+            if (self->encoderInput->takePress()) pressed = true;
+#else
+            // Queued path: accumulator only provides sample timestamps
+            self->encoderInput->takeDiff();
+            self->encoderInput->takePress();
+#endif
+            if (diff != 0 || pressed)
+            {
+                const uint32_t since = self->encoderInput->takeSince();
+                if (since)
+                {
+                    const uint32_t latencyUs = micros() - since;
+                    self->inputLatencySamples++;
+                    self->inputLatencyTotalUs += latencyUs;
+                    if (latencyUs > self->inputLatencyMaxUs) self->inputLatencyMaxUs = latencyUs;
+                }
+            }
+        }
+
+        data->enc_diff = diff;
+        data->state = pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+    }
+
+    void DisplayManager::processLocalInput(const Event &event)
+    {
+        if (appCallback) {
+            appCallback(event);
+        }
+
+        handleEncoderEvent(event, false);
+    }
+
+    void DisplayManager::handleEncoderEvent(const Event &event, bool feedLvgl)
+    {
+        switch (event.type)
         {
-            self->encoder_state = LV_INDEV_STATE_RELEASED;
+        case EventType::ENCODER_ROTATION:
+            wakeUp();
+            if (feedLvgl) encoder_diff += event.value;
+            if (currentScreen == Screen::HELLO_WORLD && label_hello_status) {
+                lv_label_set_text_fmt(label_hello_status, UiStrings::HELLO_ROTATION,
+                                      event.value > 0 ? UiStrings::HELLO_ROTATION_RIGHT : UiStrings::HELLO_ROTATION_LEFT);
+            }
+            break;
+
+        case EventType::ENCODER_CLICK:
+            wakeUp();
+            if (feedLvgl) encoder_state = LV_INDEV_STATE_PRESSED;
+            if (currentScreen == Screen::HELLO_WORLD && label_hello_status) {
+                lv_label_set_text(label_hello_status, UiStrings::HELLO_CLICK);
+            }
+            break;
+
+        case EventType::ENCODER_LONG_PRESS:
+            wakeUp();
+            if (feedLvgl) encoder_state = LV_INDEV_STATE_PRESSED;
+            if (currentScreen == Screen::HELLO_WORLD && label_hello_status) {
+                lv_label_set_text(label_hello_status, UiStrings::HELLO_LONG_PRESS);
+            }
+            break;
+
+        default:
+            break;
         }
     }
 
@@ -204,42 +972,22 @@ namespace CloudMouse::Hardware
             wakeUp();
             // Display activation - show default interactive screen
             Serial.println("📺 Display wake up - switching to HELLO_WORLD");
-            currentScreen = Screen::HELLO_WORLD;
-            lv_disp_load_scr(screen_hello_world);
+            showScreen(Screen::HELLO_WORLD);
             break;
 
         case EventType::DISPLAY_WIFI_CONNECTING:
-            currentScreen = Screen::WIFI_CONNECTING;
-            lv_disp_load_scr(screen_wifi_connecting);
+            showScreen(Screen::WIFI_CONNECTING);
             break;
 
         case EventType::ENCODER_ROTATION:
-            wakeUp();
-            encoder_diff += event.value; 
-            if (currentScreen == Screen::HELLO_WORLD) {
-                lv_label_set_text_fmt(label_hello_status, "Encoder rotation: %s", event.value > 0 ? "RIGHT" : "LEFT");
-            }
-            break;
-
         case EventType::ENCODER_CLICK:
-            wakeUp();
-            encoder_state = LV_INDEV_STATE_PRESSED;
-            if (currentScreen == Screen::HELLO_WORLD) {
-                lv_label_set_text(label_hello_status, "Click!");
-            }
-            break;
-
         case EventType::ENCODER_LONG_PRESS:
-            wakeUp();
-            encoder_state = LV_INDEV_STATE_PRESSED; 
-            if (currentScreen == Screen::HELLO_WORLD) {
-                lv_label_set_text(label_hello_status, "Long Press!");
-            }
+            handleEncoderEvent(event, true);
             break;
 
         case EventType::DISPLAY_WIFI_AP_MODE:
             wakeUp();
-            currentScreen = Screen::WIFI_AP_MODE;
+            if (showScreen(Screen::WIFI_AP_MODE))
             { 
                 String apSSID = GET_AP_SSID();
                 String apPassword = GET_AP_PASSWORD();
@@ -247,22 +995,104 @@ namespace CloudMouse::Hardware
                 
                 lv_label_set_text(label_ap_mode_ssid, apSSID.c_str());
                 lv_label_set_text(label_ap_mode_pass, apPassword.c_str());
-                lv_qrcode_set_data(qr_ap_mode, qrData.c_str());
+                qrCache.show(qr_ap_mode, qrData.c_str(), QR_SIZE_PX, lv_color_hex(0x000000), lv_color_hex(0xFFFFFF));
             }
-            lv_disp_load_scr(screen_ap_mode);
             break;
 
         case EventType::DISPLAY_WIFI_SETUP_URL:
             wakeUp();
-            currentScreen = Screen::WIFI_AP_CONNECTED;
-            
-            lv_qrcode_set_data(qr_ap_connected, WIFI_CONFIG_SERVICE);
-            lv_label_set_text(label_ap_connected_url, WIFI_CONFIG_SERVICE);
-            lv_disp_load_scr(screen_ap_connected);
+            if (showScreen(Screen::WIFI_AP_CONNECTED))
+            {
+                Utils::QRCodeCache::render(qr_ap_connected, WIFI_CONFIG_QR.matrix(), QR_SIZE_PX, lv_color_hex(0x000000), lv_color_hex(0xFFFFFF));
+                lv_label_set_text(label_ap_connected_url, WIFI_CONFIG_SERVICE);
+            }
+            break;
+
+        case EventType::DISPLAY_LIST_DEMO:
+            wakeUp();
+            if (showScreen(Screen::LIST_DEMO))
+            {
+                demoList.setCount(event.value > 0 ? (uint32_t)event.value : 1000);
+                demoList.focus(encoder_group);
+                Serial.printf("📜 List demo: %lu items on %u row objects\n",
+                              (unsigned long)demoList.getCount(), demoList.getRowObjects());
+            }
+            break;
+
+        case EventType::DISPLAY_PERF_HUD:
+            if (event.value < 0) perfHud.toggle();
+            else perfHud.setVisible(event.value != 0);
+            break;
+
+        case EventType::DISPLAY_CAPTURE:
+        {
+            CaptureSink sink = CaptureSink::SERIAL_PORT;
+            if (strcmp(event.stringData, "http") == 0) sink = CaptureSink::HTTP;
+            else if (strcmp(event.stringData, "ws") == 0) sink = CaptureSink::WEBSOCKET;
+            if (event.value < 0)
+            {
+                capture.stop();
+                capture.print();
+                break;
+            }
+
+            wakeUp(); // Paused displays render nothing to capture
+            if (event.value == 0) capture.requestScreenshot(sink);
+            else capture.startStream((uint8_t)(event.value > 255 ? 255 : event.value), sink);
+            break;
+        }
+
+        case EventType::DISPLAY_COLOR_MODE:
+            if (event.value < 0)
+            {
+                runColorBenchmark(-event.value);
+            }
+            else if (setColorMode(event.value ? DisplayColorMode::INDEXED : DisplayColorMode::RGB565) && event.value)
+            {
+                palette.print();
+            }
             break;
 
         case EventType::DISPLAY_CLEAR:
-            lv_obj_clean(lv_screen_active()); 
+            // Widgets of the active screen are gone; it is rebuilt on its next load
+            screens.cleanActive();
+            break;
+
+        case EventType::DISPLAY_BENCHMARK:
+            runRedrawBenchmark(event.value);
+            break;
+
+        case EventType::DISPLAY_BUFFER_SWEEP:
+            runBufferSweep(event.value);
+            break;
+
+        case EventType::DISPLAY_RENDER_STATS:
+            printRenderStats(event.value != 0);
+            break;
+
+        case EventType::DISPLAY_REDRAW_OVERLAY:
+            setRedrawOverlay(event.value != 0);
+            break;
+
+        case EventType::DISPLAY_SCREEN_STATS:
+            printScreenStats();
+            break;
+
+        case EventType::DISPLAY_FONT_BENCHMARK:
+            runFontBenchmark(event.value);
+            break;
+
+        case EventType::DISPLAY_QR_STATS:
+            printQRStats();
+            break;
+
+        case EventType::DISPLAY_STYLE_BENCHMARK:
+            runStyleBenchmark(event.value);
+            break;
+
+        case EventType::DISPLAY_BUFFER_CONFIG:
+            // value: (mode << 16) | lines
+            configureBuffers((DisplayBufferMode)((event.value >> 16) & 0xFF), event.value & 0xFFFF);
             break;
 
         default:
@@ -278,133 +1108,267 @@ namespace CloudMouse::Hardware
         lv_obj_t* header = lv_obj_create(parent);
         lv_obj_set_size(header, 480, 40);
         lv_obj_align(header, LV_ALIGN_TOP_MID, 0, 0);
-        lv_obj_set_style_bg_color(header, lv_color_hex(0x222222), 0);
-        lv_obj_set_style_border_width(header, 0, 0);
-        lv_obj_set_style_radius(header, 0, 0);
+        UiTheme::apply(header, UiStyle::HEADER);
 
         lv_obj_t* label = lv_label_create(header);
         lv_label_set_text(label, title);
-        lv_obj_set_style_text_color(label, lv_color_hex(COLOR_TEXT), 0);
+        UiTheme::apply(label, UiStyle::HEADER_LABEL);
         lv_obj_center(label);
         
         return header;
     }
 
+    lv_obj_t* DisplayManager::createStyleSample() {
+        // List-like layout: many labels sharing a few roles, as larger UIs do
+        lv_obj_t* sample = lv_obj_create(NULL);
+        UiTheme::apply(sample, UiStyle::SCREEN);
+        createHeader(sample, UiStrings::HEADER_BOILERPLATE);
+
+        lv_obj_t* title = lv_label_create(sample);
+        lv_label_set_text(title, UiStrings::HELLO_TITLE);
+        UiTheme::apply(title, UiStyle::TITLE);
+        lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 48);
+
+        for (int row = 0; row < 6; row++) {
+            lv_obj_t* status = lv_label_create(sample);
+            lv_label_set_text(status, UiStrings::HELLO_READY);
+            UiTheme::apply(status, UiStyle::BODY);
+            lv_obj_align(status, LV_ALIGN_TOP_LEFT, 20, 96 + row * 36);
+
+            lv_obj_t* hint = lv_label_create(sample);
+            lv_label_set_text(hint, UiStrings::WIFI_PLEASE_WAIT);
+            UiTheme::apply(hint, UiStyle::HINT);
+            lv_obj_align(hint, LV_ALIGN_TOP_RIGHT, -20, 96 + row * 36);
+        }
+
+        return sample;
+    }
+
     void DisplayManager::createUi()
     {
-        lv_obj_set_style_bg_color(lv_screen_active(), lv_color_hex(COLOR_BG), 0); 
+        UiTheme::init(fontTitle, fontStatus);
+        UiTheme::apply(lv_screen_active(), UiStyle::SCREEN);
+
+        // Screens are only registered here and built on first load. The setup screens
+        // are shown once per provisioning, so they give their LVGL heap back when left.
+        screens.setCallbacks(buildScreen, releaseScreen, this);
+        screens.setLifecycleCallback(onScreenLifecycle);
+        screens.add((uint8_t)Screen::HELLO_WORLD, "hello_world", ScreenRetention::KEEP);
+        screens.add((uint8_t)Screen::WIFI_CONNECTING, "wifi_connecting", ScreenRetention::CACHED);
+        screens.add((uint8_t)Screen::WIFI_AP_MODE, "wifi_ap_mode", ScreenRetention::DESTROY_ON_LEAVE);
+        screens.add((uint8_t)Screen::WIFI_AP_CONNECTED, "wifi_ap_connected", ScreenRetention::DESTROY_ON_LEAVE);
+        screens.add((uint8_t)Screen::LIST_DEMO, "list_demo", ScreenRetention::DESTROY_ON_LEAVE);
+    }
+
+    bool DisplayManager::showScreen(Screen screen)
+    {
+        if (!screens.load((uint8_t)screen))
+        {
+            return false;
+        }
 
-        createHelloWorldScreen();
-        createWifiConnectingScreen();
-        createApModeScreen();
-        createApConnectedScreen();
+        currentScreen = screen;
+        return true;
     }
 
-    void DisplayManager::createHelloWorldScreen()
+    lv_obj_t *DisplayManager::buildScreen(uint8_t id, void *context)
     {
-        screen_hello_world = lv_obj_create(NULL);
-        lv_obj_set_style_bg_color(screen_hello_world, lv_color_hex(COLOR_BG), 0);
-        createHeader(screen_hello_world, "CloudMouse Boilerplate");
+        DisplayManager *self = (DisplayManager *)context;
+
+        switch ((Screen)id)
+        {
+        case Screen::HELLO_WORLD:
+            return self->createHelloWorldScreen();
+        case Screen::WIFI_CONNECTING:
+            return self->createWifiConnectingScreen();
+        case Screen::WIFI_AP_MODE:
+            return self->createApModeScreen();
+        case Screen::WIFI_AP_CONNECTED:
+            return self->createApConnectedScreen();
+        case Screen::LIST_DEMO:
+            return self->createListDemoScreen();
+        default:
+            return nullptr;
+        }
+    }
+
+    void DisplayManager::onScreenLifecycle(uint8_t id, ScreenLifecycleEvent event, void *context)
+    {
+        DisplayManager *self = (DisplayManager *)context;
+
+        // Hidden screens keep their widgets but must not animate in the background
+        if (event == ScreenLifecycleEvent::UNLOADED)
+        {
+            self->screens.suspend(id);
+        }
+        else
+        {
+            self->screens.resume(id);
+        }
+    }
+
+    void DisplayManager::releaseScreen(uint8_t id, void *context)
+    {
+        DisplayManager *self = (DisplayManager *)context;
+
+        switch ((Screen)id)
+        {
+        case Screen::HELLO_WORLD:
+            self->label_hello_status = nullptr;
+            break;
+        case Screen::WIFI_CONNECTING:
+            self->spinner_wifi = nullptr;
+            self->label_wifi_status = nullptr;
+            break;
+        case Screen::WIFI_AP_MODE:
+            self->qr_ap_mode = nullptr;
+            self->label_ap_mode_ssid = nullptr;
+            self->label_ap_mode_pass = nullptr;
+            break;
+        case Screen::WIFI_AP_CONNECTED:
+            self->qr_ap_connected = nullptr;
+            self->label_ap_connected_url = nullptr;
+            break;
+        case Screen::LIST_DEMO:
+            // The list detaches itself when its objects are deleted; leave encoder edit mode
+            lv_group_set_editing(self->encoder_group, false);
+            break;
+        }
+    }
+
+    lv_obj_t* DisplayManager::createHelloWorldScreen()
+    {
+        lv_obj_t* screen_hello_world = lv_obj_create(NULL);
+        UiTheme::apply(screen_hello_world, UiStyle::SCREEN);
+        createHeader(screen_hello_world, UiStrings::HEADER_BOILERPLATE);
 
         lv_obj_t* title = lv_label_create(screen_hello_world);
-        lv_label_set_text(title, "Hello CloudMouse!");
-        lv_obj_set_style_text_color(title, lv_color_hex(COLOR_ACCENT), 0);
-        lv_obj_set_style_text_font(title, &lv_font_montserrat_28, 0);
+        lv_label_set_text(title, UiStrings::HELLO_TITLE);
+        UiTheme::apply(title, UiStyle::TITLE);
         lv_obj_align(title, LV_ALIGN_CENTER, 0, -40);
 
         label_hello_status = lv_label_create(screen_hello_world);
-        lv_label_set_text(label_hello_status, "Ready!");
-        lv_obj_set_style_text_color(label_hello_status, lv_color_hex(COLOR_TEXT), 0);
-        lv_obj_set_style_text_font(label_hello_status, &lv_font_montserrat_20, 0);
+        lv_label_set_text(label_hello_status, UiStrings::HELLO_READY);
+        UiTheme::apply(label_hello_status, UiStyle::STATUS);
         lv_obj_align(label_hello_status, LV_ALIGN_CENTER, 0, 20);
         
         lv_obj_t* instructions = lv_label_create(screen_hello_world);
-        lv_label_set_text(instructions, "Rotate the knob or push the button");
-        lv_obj_set_style_text_color(instructions, lv_color_hex(0x888888), 0);
+        lv_label_set_text(instructions, UiStrings::HELLO_INSTRUCTIONS);
+        UiTheme::apply(instructions, UiStyle::HINT);
         lv_obj_align(instructions, LV_ALIGN_BOTTOM_MID, 0, -20);
+
+        return screen_hello_world;
     }
 
-    void DisplayManager::createWifiConnectingScreen()
+    lv_obj_t* DisplayManager::createWifiConnectingScreen()
     {
-        screen_wifi_connecting = lv_obj_create(NULL);
-        lv_obj_set_style_bg_color(screen_wifi_connecting, lv_color_hex(COLOR_BG), 0);
-        createHeader(screen_wifi_connecting, "CloudMouse Boilerplate");
+        lv_obj_t* screen_wifi_connecting = lv_obj_create(NULL);
+        UiTheme::apply(screen_wifi_connecting, UiStyle::SCREEN);
+        createHeader(screen_wifi_connecting, UiStrings::HEADER_BOILERPLATE);
 
         lv_obj_t* title = lv_label_create(screen_wifi_connecting);
-        lv_label_set_text(title, "Connecting to WiFi");
-        lv_obj_set_style_text_color(title, lv_color_hex(COLOR_ACCENT), 0);
-        lv_obj_set_style_text_font(title, &lv_font_montserrat_28, 0);
+        lv_label_set_text(title, UiStrings::WIFI_CONNECTING_TITLE);
+        UiTheme::apply(title, UiStyle::TITLE);
         lv_obj_align(title, LV_ALIGN_CENTER, 0, -40);
 
         label_wifi_status = lv_label_create(screen_wifi_connecting);
-        lv_label_set_text(label_wifi_status, "Please wait...");
-        lv_obj_set_style_text_color(label_wifi_status, lv_color_hex(COLOR_TEXT), 0);
-        lv_obj_set_style_text_font(label_wifi_status, &lv_font_montserrat_20, 0);
+        lv_label_set_text(label_wifi_status, UiStrings::WIFI_PLEASE_WAIT);
+        UiTheme::apply(label_wifi_status, UiStyle::STATUS);
         lv_obj_align(label_wifi_status, LV_ALIGN_CENTER, 0, 20);
 
         spinner_wifi = lv_spinner_create(screen_wifi_connecting);
         lv_obj_set_size(spinner_wifi, 64, 64);
         lv_obj_align(spinner_wifi, LV_ALIGN_CENTER, 0, 80);
-        lv_obj_set_style_arc_color(spinner_wifi, lv_color_hex(COLOR_ACCENT), LV_PART_INDICATOR);
+        UiTheme::apply(spinner_wifi, UiStyle::SPINNER_ARC, LV_PART_INDICATOR);
+
+        return screen_wifi_connecting;
     }
 
-    void DisplayManager::createApModeScreen()
+    lv_obj_t* DisplayManager::createApModeScreen()
     {
-        screen_ap_mode = lv_obj_create(NULL);
-        lv_obj_set_style_bg_color(screen_ap_mode, lv_color_hex(TFT_DARKGRAY), 0);
-        createHeader(screen_ap_mode, "WiFi Setup Required");
+        lv_obj_t* screen_ap_mode = lv_obj_create(NULL);
+        UiTheme::apply(screen_ap_mode, UiStyle::SCREEN_SETUP);
+        createHeader(screen_ap_mode, UiStrings::HEADER_WIFI_SETUP);
 
         lv_obj_t* title = lv_label_create(screen_ap_mode);
-        lv_label_set_text(title, "Connect to CloudMouse");
-        lv_obj_set_style_text_color(title, lv_color_hex(COLOR_ACCENT), 0);
+        lv_label_set_text(title, UiStrings::AP_MODE_TITLE);
+        UiTheme::apply(title, UiStyle::HEADING);
         lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 60);
 
         label_ap_mode_ssid = lv_label_create(screen_ap_mode);
-        lv_label_set_text(label_ap_mode_ssid, "SSID: ...");
-        lv_obj_set_style_text_color(label_ap_mode_ssid, lv_color_hex(COLOR_TEXT), 0);
+        lv_label_set_text(label_ap_mode_ssid, UiStrings::AP_MODE_SSID_PLACEHOLDER);
+        UiTheme::apply(label_ap_mode_ssid, UiStyle::BODY);
         lv_obj_align(label_ap_mode_ssid, LV_ALIGN_TOP_MID, 0, 90);
 
         label_ap_mode_pass = lv_label_create(screen_ap_mode);
-        lv_label_set_text(label_ap_mode_pass, "Pass: ...");
-        lv_obj_set_style_text_color(label_ap_mode_pass, lv_color_hex(COLOR_TEXT), 0);
+        lv_label_set_text(label_ap_mode_pass, UiStrings::AP_MODE_PASS_PLACEHOLDER);
+        UiTheme::apply(label_ap_mode_pass, UiStyle::BODY);
         lv_obj_align(label_ap_mode_pass, LV_ALIGN_TOP_MID, 0, 110);
 
         qr_ap_mode = lv_qrcode_create(screen_ap_mode);
-        lv_obj_set_size(qr_ap_mode, 180, 180); 
-        lv_qrcode_set_dark_color(qr_ap_mode, lv_color_hex(0x000000));
-        lv_qrcode_set_light_color(qr_ap_mode, lv_color_hex(0xFFFFFF));
-        
-        lv_qrcode_set_data(qr_ap_mode, "WIFI:T:WPA;S:...;P:...;;"); 
+        // Content is rendered by qrCache when the screen is shown
+        lv_qrcode_set_size(qr_ap_mode, QR_SIZE_PX);
+        UiTheme::apply(qr_ap_mode, UiStyle::QR);
         lv_obj_align(qr_ap_mode, LV_ALIGN_CENTER, 0, 40);
+
+        return screen_ap_mode;
     }
 
-    void DisplayManager::createApConnectedScreen()
+    lv_obj_t* DisplayManager::createApConnectedScreen()
     {
-        screen_ap_connected = lv_obj_create(NULL);
-        lv_obj_set_style_bg_color(screen_ap_connected, lv_color_hex(TFT_DARKGREEN), 0);
-        createHeader(screen_ap_connected, "WiFi Configuration");
+        lv_obj_t* screen_ap_connected = lv_obj_create(NULL);
+        UiTheme::apply(screen_ap_connected, UiStyle::SCREEN_CONFIRMED);
+        createHeader(screen_ap_connected, UiStrings::HEADER_WIFI_CONFIG);
 
         lv_obj_t* title = lv_label_create(screen_ap_connected);
-        lv_label_set_text(title, "✅ Connected!");
-        lv_obj_set_style_text_color(title, lv_color_hex(COLOR_SUCCESS), 0);
+        lv_label_set_text(title, UiStrings::AP_CONNECTED_TITLE);
+        UiTheme::apply(title, UiStyle::HEADING_SUCCESS);
         lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 60);
         
         lv_obj_t* subtitle = lv_label_create(screen_ap_connected);
-        lv_label_set_text(subtitle, "Scan QR to setup WiFi");
-        lv_obj_set_style_text_color(subtitle, lv_color_hex(COLOR_TEXT), 0);
+        lv_label_set_text(subtitle, UiStrings::AP_CONNECTED_SUBTITLE);
+        UiTheme::apply(subtitle, UiStyle::BODY);
         lv_obj_align(subtitle, LV_ALIGN_TOP_MID, 0, 90);
 
         qr_ap_connected = lv_qrcode_create(screen_ap_connected);
-        lv_obj_set_size(qr_ap_connected, 180, 180); 
-        lv_qrcode_set_dark_color(qr_ap_connected, lv_color_hex(0x000000));
-        lv_qrcode_set_light_color(qr_ap_connected, lv_color_hex(0xFFFFFF));
-        
-        lv_qrcode_set_data(qr_ap_connected, "http://..."); 
+        // Content is rendered by qrCache when the screen is shown
+        lv_qrcode_set_size(qr_ap_connected, QR_SIZE_PX);
+        UiTheme::apply(qr_ap_connected, UiStyle::QR);
         lv_obj_align(qr_ap_connected, LV_ALIGN_CENTER, 0, 30);
         
         label_ap_connected_url = lv_label_create(screen_ap_connected);
-        lv_label_set_text(label_ap_connected_url, "http://..."); 
-        lv_obj_set_style_text_color(label_ap_connected_url, lv_color_hex(COLOR_TEXT), 0);
+        lv_label_set_text(label_ap_connected_url, UiStrings::URL_PLACEHOLDER);
+        UiTheme::apply(label_ap_connected_url, UiStyle::BODY);
         lv_obj_align(label_ap_connected_url, LV_ALIGN_BOTTOM_MID, 0, -20);
+
+        return screen_ap_connected;
+    }
+
+    lv_obj_t* DisplayManager::createListDemoScreen()
+    {
+        lv_obj_t* screen_list_demo = lv_obj_create(NULL);
+        UiTheme::apply(screen_list_demo, UiStyle::SCREEN);
+        createHeader(screen_list_demo, UiStrings::HEADER_LIST_DEMO);
+
+        lv_obj_t* list = demoList.create(screen_list_demo, 480, 280, 40);
+        if (list) {
+            lv_obj_align(list, LV_ALIGN_TOP_LEFT, 0, 40);
+            demoList.setDataSource(bindDemoItem, selectDemoItem, this);
+        }
+
+        return screen_list_demo;
+    }
+
+    void DisplayManager::bindDemoItem(uint32_t index, lv_obj_t *label, void *context)
+    {
+        (void)context;
+        lv_label_set_text_fmt(label, UiStrings::LIST_DEMO_ITEM, (unsigned long)index + 1);
+    }
+
+    void DisplayManager::selectDemoItem(uint32_t index, void *context)
+    {
+        DisplayManager *self = (DisplayManager *)context;
+        Serial.printf("📜 List item %lu selected (%lu rows bound so far)\n",
+                      (unsigned long)index + 1, (unsigned long)self->demoList.getBinds());
     }
-} // namespace CloudMouse::Hardware
\ No newline at end of file
+} // namespace CloudMouse::Hardware
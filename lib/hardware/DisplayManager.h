@@ -1,19 +1,99 @@
 #pragma once
 
 #include <Arduino.h>
-#include <Ticker.h>
+#include <esp_heap_caps.h>
 #include <lvgl.h>
+#ifdef CLOUDMOUSE_HOST_BUILD
+#include "FramebufferDisplay.h"
+#else
 #include "LGFX_ILI9488.h"
+#endif
+#include "RenderStats.h"
+#include "PixelConverter.h"
+#include "IndexedPalette.h"
+#include "ScreenRegistry.h"
+#include "Backlight.h"
+#include "EncoderInput.h"
+#include "FontCache.h"
+#include "UiTheme.h"
+#include "VirtualList.h"
+#include "PerfHud.h"
+#include "ScreenCapture.h"
+#include "UiFonts.h"
+#include "../utils/QRCodeCache.h"
 #include "../core/Events.h"
 #include "../config/DeviceConfig.h"
+#include "../config/UiStrings.h"
 
 /**
- * Operational and idle brightness targets with dimmer fade out
+ * Operational and idle backlight levels (perceptual, see Backlight), faded in on
+ * interaction and out after DISPLAY_IDLE_TIMEOUT_MS without input.
+ * 217 / 58 give the same PWM duty as the former linear 180 / 10.
  */
-#define BRIGHTNESS_UP_TARGET 180
-#define BRIGHTNESS_IDLE_TARGET 10
-#define FADE_OUT_STEP_DELAY_MS 20
-#define FADE_OUT_STEP_VALUE 2
+#define BRIGHTNESS_UP_TARGET 217
+#define BRIGHTNESS_IDLE_TARGET 58
+#define DISPLAY_IDLE_TIMEOUT_MS 10000
+
+/**
+ * Idle render mode: once the fade-out has reached the idle level, LVGL timers and
+ * animations stop and nothing is flushed. After DISPLAY_SLEEP_TIMEOUT_MS without
+ * input the backlight turns off and, with DISPLAY_PANEL_SLEEP, the ILI9488 enters
+ * sleep mode. Any input resumes with a full refresh. 0 disables the sleep stage.
+ */
+#ifndef DISPLAY_SLEEP_TIMEOUT_MS
+#define DISPLAY_SLEEP_TIMEOUT_MS 60000
+#endif
+
+#ifndef DISPLAY_PANEL_SLEEP
+#define DISPLAY_PANEL_SLEEP 1
+#endif
+
+/**
+ * Asynchronous DMA flush: LVGL renders the next band while the previous one
+ * is clocked out over SPI. Set to 0 to fall back to blocking pushImage().
+ */
+#ifndef DISPLAY_ASYNC_FLUSH
+#define DISPLAY_ASYNC_FLUSH 1
+#endif
+
+/**
+ * LVGL render band configuration (overridable with build flags)
+ * - DISPLAY_BUFFER_LINES: band height in pixel rows for each of the two draw buffers
+ * - DISPLAY_BUFFER_MODE: placement strategy, see DisplayBufferMode
+ */
+#ifndef DISPLAY_BUFFER_LINES
+#define DISPLAY_BUFFER_LINES 32
+#endif
+
+#ifndef DISPLAY_BUFFER_MODE
+#define DISPLAY_BUFFER_MODE DisplayBufferMode::PSRAM
+#endif
+
+/**
+ * Async flush pre-converts RGB565 bands to the panel's 3-byte SPI format into two
+ * small internal DMA staging buffers (ping-pong), so conversion of one chunk overlaps
+ * the transfer of the previous one and the LVGL band is released immediately.
+ * - DISPLAY_STAGING_LINES: rows per staging chunk at full width (0 disables staging)
+ * - DISPLAY_RGB565_SWAPPED: set to 1 if LVGL renders byte-swapped RGB565
+ *   (LVGL v9 renders native RGB565; LV_COLOR_16_SWAP is a v8 option and is ignored)
+ */
+#ifndef DISPLAY_STAGING_LINES
+#define DISPLAY_STAGING_LINES 4
+#endif
+
+#ifndef DISPLAY_RGB565_SWAPPED
+#define DISPLAY_RGB565_SWAPPED 0
+#endif
+
+/**
+ * Indexed colour mode: LVGL renders 8-bit L8 bands (half the RGB565 buffer size, so
+ * taller bands fit in internal DMA RAM) and the flush expands them through the
+ * IndexedPalette LUT into the staging buffers. Needs DISPLAY_STAGING_LINES > 0.
+ * Switchable at runtime with "display color rgb565|indexed".
+ */
+#ifndef DISPLAY_INDEXED_COLOR
+#define DISPLAY_INDEXED_COLOR 0
+#endif
 
 /**
  * Display Management Controller
@@ -49,6 +129,43 @@ namespace CloudMouse::Hardware
      */
     typedef void (*AppDisplayCallback)(const CloudMouse::Event& event);
 
+    /**
+     * LVGL draw buffer placement strategy
+     * - INTERNAL_DMA: both bands in internal DMA-capable RAM (fastest, costs internal heap)
+     * - PSRAM: both bands in PSRAM (no internal heap, every access through the PSRAM cache)
+     * - HYBRID: LVGL renders into a single internal band (half the internal cost); the
+     *   flush releases it at once and PSRAM only holds the copy the SPI DMA reads from.
+     *   With DMA staging the converted RGB666 chunks are that copy, no PSRAM is used.
+     */
+    enum class DisplayBufferMode
+    {
+        INTERNAL_DMA,
+        PSRAM,
+        HYBRID
+    };
+
+    /**
+     * LVGL render format (see DISPLAY_INDEXED_COLOR)
+     * - RGB565: 2 bytes per pixel, converted to RGB666 at flush
+     * - INDEXED: 1 byte per pixel (L8), expanded through the palette LUT at flush
+     */
+    enum class DisplayColorMode
+    {
+        RGB565,
+        INDEXED
+    };
+
+    /**
+     * Display power state (see DISPLAY_SLEEP_TIMEOUT_MS)
+     */
+    enum class DisplayPowerState
+    {
+        ACTIVE,   // Rendering, full brightness
+        DIMMING,  // Rendering, backlight fading to idle level
+        PAUSED,   // Idle level reached, LVGL not run, nothing flushed
+        SLEEPING  // Backlight off, panel in sleep mode
+    };
+
     class DisplayManager
     {
     public:
@@ -59,6 +176,26 @@ namespace CloudMouse::Hardware
         void update();
         void processEvent(const CloudMouse::Event &event);
 
+        /**
+         * Direct encoder path: LVGL reads rotation and presses from this accumulator
+         * in its indev callback instead of waiting for ENCODER_* events.
+         * Encoder events still arriving through processEvent() are applied as well.
+         */
+        void setEncoderInput(EncoderInput *input) { encoderInput = input; }
+
+        /**
+         * Encoder event sampled by the input stage (ENCODER_DIRECT_INPUT), delivered
+         * on the render task before the next frame. Runs the app callback and screen
+         * feedback; LVGL already has the input through the accumulator, so it is not
+         * applied twice.
+         */
+        void processLocalInput(const CloudMouse::Event &event);
+
+        /**
+         * Current power state; rendering only happens in ACTIVE and DIMMING
+         */
+        DisplayPowerState getPowerState() const { return powerState; }
+
         /**
          * Register callback function for custom DislpayManager
          * 
@@ -83,6 +220,123 @@ namespace CloudMouse::Hardware
         int getHeight() const { return 320; }
         bool isAnimating() const { return initialized; }
 
+        // ========================================================================
+        // RENDER PIPELINE DIAGNOSTICS
+        // ========================================================================
+
+        /**
+         * Switch between asynchronous DMA flush and blocking flush at runtime
+         * Must be called from the UI task (same task that runs lv_timer_handler)
+         */
+        void setAsyncFlush(bool enabled);
+        bool isAsyncFlush() const { return asyncFlush; }
+
+        /**
+         * Measure full-screen redraw time in blocking and async flush modes
+         * Prints results to Serial. Must be called from the UI task.
+         *
+         * @param iterations Number of forced full redraws per mode
+         */
+        void runRedrawBenchmark(int iterations);
+
+        /**
+         * Reallocate LVGL draw buffers with a new placement and band height
+         * The new pair is allocated before the old one is freed; when both do not fit,
+         * falls back to PSRAM with the default band height, then to the previous
+         * configuration. Must be called from the UI task.
+         *
+         * @param mode Buffer placement strategy
+         * @param lines Band height in pixel rows (1-320)
+         * @return true if the requested configuration is active
+         */
+        bool configureBuffers(DisplayBufferMode mode, uint16_t lines);
+        DisplayBufferMode getBufferMode() const { return bufferMode; }
+        uint16_t getBufferLines() const { return bufferLines; }
+        static const char *bufferModeName(DisplayBufferMode mode);
+
+        /**
+         * Sweep buffer modes and band heights, printing FPS, flush time and RAM cost
+         * Restores the active configuration afterwards. Must be called from the UI task.
+         *
+         * @param iterations Number of forced full redraws per configuration
+         */
+        void runBufferSweep(int iterations);
+
+        /**
+         * Switch LVGL between RGB565 and indexed (L8 + LUT) rendering
+         * Keeps the band height; the buffers are reallocated at the new pixel size.
+         * Must be called from the UI task.
+         *
+         * @return false if indexed mode is requested without DMA staging buffers
+         */
+        bool setColorMode(DisplayColorMode mode);
+        DisplayColorMode getColorMode() const { return colorMode; }
+        const IndexedPalette &getPalette() const { return palette; }
+        static const char *colorModeName(DisplayColorMode mode);
+
+        /**
+         * Compare RGB565 and indexed rendering: frame, render and flush time, fill
+         * rate and buffer memory, including indexed bands twice as tall (same bytes).
+         * Restores the active configuration afterwards. Must be called from the UI task.
+         *
+         * @param iterations Number of forced full redraws per configuration
+         */
+        void runColorBenchmark(int iterations);
+
+        /**
+         * Per-screen dirty-region and SPI bandwidth analytics
+         * printRenderStats() dumps aggregates to Serial, optionally resetting them.
+         * setRedrawOverlay() outlines invalidated rectangles on the panel.
+         */
+        const RenderStats &getRenderStats() const { return renderStats; }
+        void printRenderStats(bool reset);
+        void setRedrawOverlay(bool enabled);
+
+        /**
+         * Lazily built screens with per-screen LVGL heap accounting; animations and
+         * timers of hidden screens are suspended until the screen is shown again.
+         * printScreenStats() dumps residency, build cost and animation counts to Serial.
+         */
+        const ScreenRegistry &getScreens() const { return screens; }
+        void printScreenStats() const { screens.print(); }
+
+        /**
+         * Compare full redraws of the active screen with glyph bitmaps read from
+         * flash and from the RAM font cache. Prints results to Serial.
+         *
+         * @param iterations Number of forced full redraws per mode
+         */
+        void runFontBenchmark(int iterations);
+
+        /**
+         * Build a sample screen with per-object local styles and with the shared
+         * UiTheme styles, and compare LVGL heap, build time and full redraw time.
+         * Prints results to Serial.
+         *
+         * @param iterations Number of forced full redraws per mode
+         */
+        void runStyleBenchmark(int iterations);
+
+        /**
+         * Content-keyed cache of QR module matrices and rendered QR bitmaps
+         * printQRStats() dumps cached payloads and encode / render / hit timings.
+         */
+        const Utils::QRCodeCache &getQRCache() const { return qrCache; }
+        void printQRStats() const { qrCache.print(); }
+
+        /**
+         * Screenshot / stream capture of flushed bands (DISPLAY_CAPTURE event)
+         * Control from the UI task; packets may be drained by one other task.
+         */
+        ScreenCapture &getCapture() { return capture; }
+
+#ifdef CLOUDMOUSE_HOST_BUILD
+        /**
+         * Host builds only: direct access to the in-memory panel for frame dumps
+         */
+        const FramebufferDisplay &getPanel() const { return display; }
+#endif
+
     private:
 
         enum class Screen
@@ -90,10 +344,15 @@ namespace CloudMouse::Hardware
             HELLO_WORLD,
             WIFI_CONNECTING,
             WIFI_AP_MODE,
-            WIFI_AP_CONNECTED
+            WIFI_AP_CONNECTED,
+            LIST_DEMO
         };
 
-        LGFX_ILI9488 display; 
+#ifdef CLOUDMOUSE_HOST_BUILD
+        FramebufferDisplay display;
+#else
+        LGFX_ILI9488 display;
+#endif
 
         // ========================================================================
         // LVGL DRIVER & BUFFER & TICKER
@@ -102,35 +361,84 @@ namespace CloudMouse::Hardware
         lv_display_t * disp;      
         lv_indev_t * indev;
 
-        static lv_color_t *buf1;
-        static lv_color_t *buf2;
+        static uint8_t *buf1;
+        static uint8_t *buf2;
+
+        DisplayBufferMode bufferMode = DISPLAY_BUFFER_MODE;
+        uint16_t bufferLines = DISPLAY_BUFFER_LINES;
+        size_t bufferBytes = 0;
+
+        DisplayColorMode colorMode = DISPLAY_INDEXED_COLOR ? DisplayColorMode::INDEXED : DisplayColorMode::RGB565;
+        IndexedPalette palette;
+        uint8_t bytesPerPixel() const { return colorMode == DisplayColorMode::INDEXED ? 1 : 2; }
+        void applyColorFormat();
+
+        static uint8_t *allocateBuffer(size_t bytes, bool internal);
+        void releaseBuffers();
+        bool allocatePair(DisplayBufferMode mode, uint16_t lines, uint8_t *&first, uint8_t *&second);
+        // Second LVGL render buffer; in HYBRID mode buf2 is the PSRAM flush copy instead
+        static uint8_t *renderBuffer2(DisplayBufferMode mode, uint8_t *second)
+        {
+            return mode == DisplayBufferMode::HYBRID ? nullptr : second;
+        }
+
+        // Time spent inside flush callbacks (blocking SPI or DMA wait)
+        uint32_t flushBusyUs = 0;
+        uint32_t flushCalls = 0;
+
+        RenderStats renderStats;
+        ScreenCapture capture;
 
         // Signature callbacks
         static void lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
+        static void lvgl_flush_wait_cb(lv_display_t *disp);
+        static void lvgl_display_event_cb(lv_event_t *e);
         static void lvgl_encoder_read_cb(lv_indev_t *indev, lv_indev_data_t *data);
+        void handleEncoderEvent(const CloudMouse::Event &event, bool feedLvgl);
 
-        Ticker lvgl_ticker;
-        static void lv_tick_task() { lv_tick_inc(5); }
+        // SPI transaction held open across bands while DMA flush is active
+        bool asyncFlush = DISPLAY_ASYNC_FLUSH;
+        bool flushTransactionOpen = false;
+
+        // Internal DMA staging buffers holding converted RGB666 chunks
+        uint8_t *staging[2] = {nullptr, nullptr};
+        uint8_t stagingIndex = 0;
+        void allocateStaging();
+        void flushStaged(const lv_area_t *area, const uint8_t *px_map);
+        void finishFlush();
+        uint32_t measureFullRedraw();
 
         // ========================================================================
         // LVGL UI OBJECTS
         // ========================================================================
 
         lv_group_t *encoder_group; 
-        
-        lv_obj_t *screen_hello_world;
-        lv_obj_t *screen_wifi_connecting;
-        lv_obj_t *screen_ap_mode;
-        lv_obj_t *screen_ap_connected;
-
-        lv_obj_t *label_hello_status;
-        lv_obj_t *spinner_wifi;
-        lv_obj_t *label_wifi_status;
-        lv_obj_t *qr_ap_mode;
-        lv_obj_t *qr_ap_connected;
-        lv_obj_t *label_ap_connected_url;
-        lv_obj_t *label_ap_mode_ssid;
-        lv_obj_t *label_ap_mode_pass;
+
+        // Screens are built on first load and torn down according to their retention
+        ScreenRegistry screens;
+
+        // Title/status fonts, RAM-cached when they fit FONT_CACHE_BUDGET
+        FontCache fontCache;
+        const lv_font_t *fontTitle = nullptr;
+        const lv_font_t *fontStatus = nullptr;
+
+        // Field performance overlay on the top layer (ultra-long press / "display hud")
+        PerfHud perfHud;
+
+        // Runtime QR payloads (AP credentials), encoded once and restored from PSRAM bitmaps
+        Utils::QRCodeCache qrCache;
+        static const int32_t QR_SIZE_PX = 180;
+
+        // Widget pointers are only valid while their screen is built
+        lv_obj_t *label_hello_status = nullptr;
+        lv_obj_t *spinner_wifi = nullptr;
+        lv_obj_t *label_wifi_status = nullptr;
+        lv_obj_t *qr_ap_mode = nullptr;
+        lv_obj_t *qr_ap_connected = nullptr;
+        lv_obj_t *label_ap_connected_url = nullptr;
+        VirtualList demoList;
+        lv_obj_t *label_ap_mode_ssid = nullptr;
+        lv_obj_t *label_ap_mode_pass = nullptr;
 
         AppDisplayCallback appCallback = nullptr;   // Custom DisplayManager callback for SDK event forwarding
 
@@ -142,32 +450,38 @@ namespace CloudMouse::Hardware
         Screen currentScreen = Screen::HELLO_WORLD;
         int32_t encoder_diff = 0;
         lv_indev_state_t encoder_state = LV_INDEV_STATE_RELEASED;
+        EncoderInput *encoderInput = nullptr;
 
-        // Brightness management variables
-        int currentBrightness = BRIGHTNESS_UP_TARGET;
-        unsigned long lastInteractionTime = 0;
-        unsigned long lastFadeTime = 0;
-
-        // ========================================================================
-        // UI COLOR SCHEME DEFINITIONS
-        // ========================================================================
+        // Encoder sample to LVGL read callback latency, reset with render stats
+        uint32_t inputLatencySamples = 0;
+        uint32_t inputLatencyTotalUs = 0;
+        uint32_t inputLatencyMaxUs = 0;
 
-        static const uint16_t COLOR_BG = 0x0000;
-        static const uint16_t COLOR_TEXT = 0xFFFF;
-        static const uint16_t COLOR_ACCENT = 0x07FF;
-        static const uint16_t COLOR_SUCCESS = 0x07E0;
-        static const uint16_t COLOR_WARNING = 0xFD20;
+        // Brightness management: LEDC hardware fades, only the idle check runs per frame
+        Backlight backlight;
+        unsigned long lastInteractionTime = 0;
+        DisplayPowerState powerState = DisplayPowerState::ACTIVE;
+        unsigned long pausedSince = 0;
 
         // ========================================================================
         // SCREEN UI CREATION METHODS
         // ========================================================================
 
         void createUi();
-        void createHelloWorldScreen();
-        void createWifiConnectingScreen();
-        void createApModeScreen();
-        void createApConnectedScreen();
+        bool showScreen(Screen screen);
+        static lv_obj_t *buildScreen(uint8_t id, void *context);
+        static void releaseScreen(uint8_t id, void *context);
+        static void onScreenLifecycle(uint8_t id, ScreenLifecycleEvent event, void *context);
+
+        lv_obj_t* createHelloWorldScreen();
+        lv_obj_t* createWifiConnectingScreen();
+        lv_obj_t* createApModeScreen();
+        lv_obj_t* createApConnectedScreen();
+        lv_obj_t* createListDemoScreen();
+        static void bindDemoItem(uint32_t index, lv_obj_t *label, void *context);
+        static void selectDemoItem(uint32_t index, void *context);
         lv_obj_t* createHeader(lv_obj_t* parent, const char* title);
+        lv_obj_t* createStyleSample();
 
         // ========================================================================
         // SCREEN BRIGHTNESS MANAGEMENT
@@ -175,5 +489,8 @@ namespace CloudMouse::Hardware
         
         void wakeUp();
         void handleDimmer();
+        void pauseRendering();
+        void enterSleep();
+        void resumeRendering();
     };
 };
\ No newline at end of file
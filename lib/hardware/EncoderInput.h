@@ -0,0 +1,94 @@
+/**
+ * CloudMouse SDK - Encoder Input Accumulator for LVGL
+ *
+ * Lock-free hand-off between EncoderManager (producer) and the LVGL encoder read
+ * callback (consumer). Rotation and presses used to reach LVGL through the event
+ * queues: UI task -> Core 0 -> UI task -> DisplayManager, two queue hops, a core
+ * switch and up to two frames of delay. With the accumulator the read callback picks
+ * up whatever arrived since the previous frame: rotation from the 2 ms PCNT sampler
+ * (esp_timer task), presses from the UI input stage. Core 0 is only notified for
+ * side effects (LED, buzzer).
+ *
+ * Latency:
+ * - The producer stamps the oldest unconsumed input with micros()
+ * - takeSince() returns that stamp, so the consumer can measure sample-to-LVGL latency
+ *
+ * Configuration:
+ * - ENCODER_DIRECT_INPUT 0 restores the queued event path (for A/B latency comparisons)
+ *
+ * Thread Safety:
+ * - All members are atomics; the producers (sampler, input stage) and the consumer
+ *   (LVGL read callback) may run on different tasks
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+#ifndef ENCODER_DIRECT_INPUT
+#define ENCODER_DIRECT_INPUT 1
+#endif
+
+namespace CloudMouse::Hardware
+{
+    class EncoderInput
+    {
+    public:
+        /**
+         * Add rotation (in detents) for LVGL
+         */
+        void pushRotation(int32_t delta, uint32_t nowUs)
+        {
+            diff.fetch_add(delta);
+            stamp(nowUs);
+        }
+
+        /**
+         * Queue one press/release cycle for LVGL
+         */
+        void pushPress(uint32_t nowUs)
+        {
+            presses.fetch_add(1);
+            stamp(nowUs);
+        }
+
+        /**
+         * Consume accumulated rotation
+         */
+        int32_t takeDiff() { return diff.exchange(0); }
+
+        /**
+         * Consume one pending press
+         *
+         * @return true if a press was pending
+         */
+        bool takePress()
+        {
+            uint16_t pending = presses.load();
+            while (pending > 0 && !presses.compare_exchange_weak(pending, pending - 1))
+            {
+            }
+            return pending > 0;
+        }
+
+        /**
+         * Consume the timestamp of the oldest input not yet seen by LVGL
+         *
+         * @return micros() when it was sampled, 0 if nothing was pending
+         */
+        uint32_t takeSince() { return sinceUs.exchange(0); }
+
+    private:
+        std::atomic<int32_t> diff{0};
+        std::atomic<uint16_t> presses{0};
+        std::atomic<uint32_t> sinceUs{0};
+
+        void stamp(uint32_t nowUs)
+        {
+            uint32_t expected = 0;
+            sinceUs.compare_exchange_strong(expected, nowUs ? nowUs : 1);
+        }
+    };
+
+} // namespace CloudMouse::Hardware
@@ -25,9 +25,24 @@
  */
 
 #include "./EncoderManager.h"
+#include "../utils/Clock.h"
+#include <math.h>
 
 namespace CloudMouse::Hardware
 {
+    using CloudMouse::Utils::Clock;
+
+    namespace
+    {
+        // Default curve: precise below ~10 detents/s, up to 8 steps per detent on fast spins
+        const EncoderAccelPoint DEFAULT_ACCEL_CURVE[] = {
+            {0.0f, 1.0f},
+            {10.0f, 1.0f},
+            {20.0f, 2.0f},
+            {40.0f, 4.0f},
+            {80.0f, 8.0f}};
+    }
+
     // ============================================================================
     // INITIALIZATION AND LIFECYCLE
     // ============================================================================
@@ -39,6 +54,16 @@ namespace CloudMouse::Hardware
         // Actual GPIO configuration happens in init() method
     }
 
+    EncoderManager::~EncoderManager()
+    {
+        if (sampleTimer)
+        {
+            esp_timer_stop(sampleTimer);
+            esp_timer_delete(sampleTimer);
+            sampleTimer = nullptr;
+        }
+    }
+
     void EncoderManager::init()
     {
         Serial.println("🎮 Initializing EncoderManager...");
@@ -59,10 +84,34 @@ namespace CloudMouse::Hardware
         // Ensures proper state tracking from startup
         lastButtonState = digitalRead(ENCODER_SW_PIN);
 
+        setAcceleration(DEFAULT_ACCEL_CURVE, sizeof(DEFAULT_ACCEL_CURVE) / sizeof(DEFAULT_ACCEL_CURVE[0]));
+
+        // Sample the PCNT counter independently of the UI frame rate
+        esp_timer_create_args_t timerArgs = {};
+        timerArgs.callback = sampleTimerCb;
+        timerArgs.arg = this;
+        timerArgs.name = "encoder";
+        if (esp_timer_create(&timerArgs, &sampleTimer) != ESP_OK ||
+            esp_timer_start_periodic(sampleTimer, ENCODER_SAMPLE_INTERVAL_US) != ESP_OK)
+        {
+            Serial.println("⚠️ Encoder sample timer unavailable, sampling from update()");
+            if (sampleTimer)
+            {
+                esp_timer_delete(sampleTimer);
+                sampleTimer = nullptr;
+            }
+        }
+
         Serial.printf("✅ EncoderManager initialized successfully\n");
         Serial.printf("🎮 Pin configuration: CLK=%d, DT=%d, SW=%d\n",
                       ENCODER_CLK_PIN, ENCODER_DT_PIN, ENCODER_SW_PIN);
         Serial.printf("🎮 Initial encoder position: %d\n", lastValue);
+        if (sampleTimer)
+        {
+            Serial.printf("🎮 Rotation sampled every %d us (%d us when idle), acceleration %s\n",
+                          ENCODER_SAMPLE_INTERVAL_US, ENCODER_IDLE_SAMPLE_INTERVAL_US,
+                          accelEnabled.load() ? "on" : "off");
+        }
     }
 
     // ============================================================================
@@ -73,10 +122,30 @@ namespace CloudMouse::Hardware
     {
         // Process encoder rotation and button state changes
         // Call both processors to ensure comprehensive input handling
-        processEncoder();
+        if (!sampleTimer)
+        {
+            processEncoder();
+        }
         processButton();
     }
 
+    void EncoderManager::setIdleSampling(bool idle)
+    {
+        if (!sampleTimer || idle == idleSampling) return;
+
+        // A callback already running completes; the next one fires at the new period
+        esp_timer_stop(sampleTimer);
+        if (esp_timer_start_periodic(sampleTimer, idle ? ENCODER_IDLE_SAMPLE_INTERVAL_US
+                                                       : ENCODER_SAMPLE_INTERVAL_US) != ESP_OK)
+        {
+            Serial.println("⚠️ Encoder sample timer restart failed, sampling from update()");
+            esp_timer_delete(sampleTimer);
+            sampleTimer = nullptr;
+            return;
+        }
+        idleSampling = idle;
+    }
+
     // ============================================================================
     // ENCODER ROTATION PROCESSING
     // ============================================================================
@@ -85,21 +154,118 @@ namespace CloudMouse::Hardware
     {
         // Read current encoder position from PCNT hardware
         // Normalize to physical detent resolution (4 counts per detent)
+        const int64_t now = Clock::nowUs();
         int newValue = encoder.position() / 4;
 
-        // Check for position change since last update
-        if (newValue != lastValue)
+        if (newValue == lastValue)
         {
-            // Calculate movement delta and accumulate for consumption
-            // Positive delta = clockwise, negative delta = counter-clockwise
-            int delta = newValue - lastValue;
-            movement += delta;
-            lastValue = newValue;
-            movementPending = true;
-
-            // Optional debug logging for development and troubleshooting
-            // Serial.printf("🔄 Encoder movement: %d (total pending: %d)\n", delta, movement);
+            // Detents stopped arriving: the spin is over
+            if (lastDetentUs && now - lastDetentUs > ENCODER_VELOCITY_TIMEOUT_MS * 1000LL)
+            {
+                velocity.store(0.0f);
+                accelCarry = 0.0f;
+                lastDetentUs = 0;
+            }
+            return;
         }
+
+        // Calculate movement delta
+        // Positive delta = clockwise, negative delta = counter-clockwise
+        int delta = newValue - lastValue;
+        lastValue = newValue;
+
+        const float previous = velocity.load();
+        float speed = 0.0f;
+        if (lastDetentUs && (previous == 0.0f || (previous > 0) == (delta > 0)))
+        {
+            // Smooth the rate implied by the interval since the previous detent
+            const float instant = (float)abs(delta) * 1000000.0f / (float)(now - lastDetentUs);
+            speed = fabsf(previous) + ENCODER_VELOCITY_SMOOTHING * (instant - fabsf(previous));
+        }
+        else
+        {
+            // First detent or direction change: no interval to measure yet
+            accelCarry = 0.0f;
+        }
+        lastDetentUs = now;
+        velocity.store(delta > 0 ? speed : -speed);
+
+        // Fractional multipliers carry over to the next detent
+        accelCarry += delta * (accelEnabled ? multiplierFor(speed) : 1.0f);
+        const int steps = (int)accelCarry;
+        accelCarry -= steps;
+
+        rawMovement.fetch_add(delta);
+        if (steps != 0)
+        {
+            movement.fetch_add(steps);
+            input.pushRotation(steps, micros());
+        }
+
+        // Optional debug logging for development and troubleshooting
+        // Serial.printf("🔄 Encoder: %d detents, %.1f/s -> %d steps\n", delta, speed, steps);
+    }
+
+    void EncoderManager::sampleTimerCb(void *arg)
+    {
+        // esp_timer task context: one PCNT read, atomics for everything shared
+        ((EncoderManager *)arg)->processEncoder();
+    }
+
+    // ============================================================================
+    // ACCELERATION CURVE
+    // ============================================================================
+
+    bool EncoderManager::setAcceleration(const EncoderAccelPoint *points, uint8_t count)
+    {
+        if (!points || count == 0 || count > ENCODER_ACCEL_MAX_POINTS)
+        {
+            Serial.printf("❌ Encoder acceleration curve needs 1-%d points\n", ENCODER_ACCEL_MAX_POINTS);
+            return false;
+        }
+
+        // The sampler may be interpolating on the esp_timer task right now
+        portENTER_CRITICAL(&accelMux);
+        memcpy(accelCurve, points, count * sizeof(EncoderAccelPoint));
+        accelPoints = count;
+        portEXIT_CRITICAL(&accelMux);
+        return true;
+    }
+
+    float EncoderManager::multiplierFor(float ticksPerSecond) const
+    {
+        // At most ENCODER_ACCEL_MAX_POINTS comparisons inside the critical section
+        portENTER_CRITICAL(&accelMux);
+        float multiplier = 1.0f;
+        if (accelPoints > 0)
+        {
+            multiplier = accelCurve[accelPoints - 1].multiplier;
+            if (ticksPerSecond <= accelCurve[0].ticksPerSecond)
+            {
+                multiplier = accelCurve[0].multiplier;
+            }
+            else
+            {
+                for (uint8_t i = 1; i < accelPoints; i++)
+                {
+                    const EncoderAccelPoint &lo = accelCurve[i - 1];
+                    const EncoderAccelPoint &hi = accelCurve[i];
+                    if (ticksPerSecond < hi.ticksPerSecond)
+                    {
+                        const float t = (ticksPerSecond - lo.ticksPerSecond) / (hi.ticksPerSecond - lo.ticksPerSecond);
+                        multiplier = lo.multiplier + t * (hi.multiplier - lo.multiplier);
+                        break;
+                    }
+                }
+            }
+        }
+        portEXIT_CRITICAL(&accelMux);
+        return multiplier;
+    }
+
+    float EncoderManager::getMultiplier() const
+    {
+        return accelEnabled ? multiplierFor(fabsf(velocity.load())) : 1.0f;
     }
 
     // ============================================================================
@@ -110,7 +276,7 @@ namespace CloudMouse::Hardware
     {
         // Sample current button state (LOW = pressed, HIGH = released)
         bool currentButtonState = digitalRead(ENCODER_SW_PIN);
-        unsigned long currentTime = millis();
+        unsigned long currentTime = Clock::nowMs();
 
         // ========================================================================
         // PRESS DETECTION (HIGH → LOW transition)
@@ -154,12 +320,14 @@ namespace CloudMouse::Hardware
             {
                 // Long press: 1000-2999ms
                 longPressPending = true;
+                input.pushPress(micros());
                 Serial.println("👆🔒 Long press event");
             }
             else if (pressDuration < CLICK_TIMEOUT)
             {
                 // Short click: < 500ms
                 clickPending = true;
+                input.pushPress(micros());
                 Serial.println("👆 Click event");
             }
             // Note: Press durations between 500-999ms are ignored (dead zone)
@@ -211,18 +379,11 @@ namespace CloudMouse::Hardware
     int EncoderManager::getMovement()
     {
         // Return accumulated movement and reset for next consumption cycle
-        if (movementPending)
-        {
-            int result = movement;   // Capture current movement total
-            movement = 0;            // Reset accumulator for next cycle
-            movementPending = false; // Clear pending flag
-
-            Serial.printf("📊 Movement consumed: %d clicks\n", result);
-            return result;
-        }
+        // (the sample timer may add to it concurrently)
+        int result = movement.exchange(0);
+        // Serial.printf("📊 Movement consumed: %d clicks\n", result);
 
-        // No movement pending - return zero
-        return 0;
+        return result;
     }
 
     bool EncoderManager::getClicked()
@@ -299,7 +460,7 @@ namespace CloudMouse::Hardware
         if (digitalRead(ENCODER_SW_PIN) == LOW)
         {
             // Button currently pressed - calculate elapsed time
-            return millis() - pressStartTime;
+            return Clock::nowMs() - pressStartTime;
         }
 
         // Button not pressed - return zero
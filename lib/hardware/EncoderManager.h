@@ -9,6 +9,7 @@
  * - Hardware-accelerated rotation counting using ESP32 PCNT (Pulse Counter) peripherals
  * - Cross-platform compatibility (ESP-IDF 4.4 vs 5.x API differences)
  * - Debounced rotation tracking with accumulated movement reporting
+ * - Timestamped high-rate PCNT sampling with velocity-based acceleration curve
  * - Multi-level button press detection (click, long press, ultra-long press)
  * - Event-based architecture with consumption semantics for reliable state management
  * - Real-time press duration monitoring for dynamic UI feedback
@@ -50,12 +51,46 @@
 
 #pragma once
 #include <Arduino.h>
+#include <atomic>
+#include <esp_timer.h>
 
 // Hardware pin definitions
 #define ENCODER_CLK_PIN 16 // Encoder Clock/A signal (quadrature phase A)
 #define ENCODER_DT_PIN 18  // Encoder Data/B signal (quadrature phase B)
 #define ENCODER_SW_PIN 17  // Encoder Switch/Button (active LOW)
 
+/**
+ * Rotation sampling: the PCNT counter is read by an esp_timer every
+ * ENCODER_SAMPLE_INTERVAL_US and each detent is timestamped, so velocity is measured
+ * from detent intervals rather than from 30 Hz frame deltas. Without the timer,
+ * update() samples instead.
+ */
+#ifndef ENCODER_SAMPLE_INTERVAL_US
+#define ENCODER_SAMPLE_INTERVAL_US 2000
+#endif
+
+/**
+ * Sample period while the display is paused or asleep (see setIdleSampling()).
+ * PCNT keeps counting in hardware, so no detents are lost; only the wake-up
+ * latency grows, and the esp_timer task stops waking every 2 ms when idle.
+ */
+#ifndef ENCODER_IDLE_SAMPLE_INTERVAL_US
+#define ENCODER_IDLE_SAMPLE_INTERVAL_US 20000
+#endif
+
+// No detent for this long resets the velocity to zero
+#ifndef ENCODER_VELOCITY_TIMEOUT_MS
+#define ENCODER_VELOCITY_TIMEOUT_MS 150
+#endif
+
+// Exponential smoothing weight of the newest detent interval (0-1)
+#ifndef ENCODER_VELOCITY_SMOOTHING
+#define ENCODER_VELOCITY_SMOOTHING 0.4f
+#endif
+
+// Maximum number of points in an acceleration curve
+#define ENCODER_ACCEL_MAX_POINTS 8
+
 // Platform-specific encoder library inclusion
 #ifdef PLATFORMIO
 #include "./RotaryEncoderPCNT.h" // Local implementation for ESP-IDF 4.4
@@ -64,6 +99,7 @@
 #endif
 
 #include "SimpleBuzzer.h"
+#include "EncoderInput.h"
 
 /**
  * Rotary Encoder Manager
@@ -79,7 +115,9 @@
  *
  * Thread Safety:
  * - Single-task usage recommended (typically main/core task)
- * - State variables are not protected by mutexes
+ * - Rotation is sampled on the esp_timer task; movement counters and velocity are atomic,
+ *   the acceleration curve is guarded by a spinlock so setAcceleration() may run anywhere
+ * - Button state variables are not protected by mutexes
  * - Event consumption is atomic at method call level
  *
  * Update Frequency:
@@ -90,6 +128,17 @@
 
 namespace CloudMouse::Hardware
 {
+    /**
+     * One point of the acceleration curve: at ticksPerSecond detents/s each detent
+     * counts as multiplier steps. Multipliers are interpolated linearly between
+     * points and held constant beyond the last one.
+     */
+    struct EncoderAccelPoint
+    {
+        float ticksPerSecond;
+        float multiplier;
+    };
+
     class EncoderManager
     {
     public:
@@ -99,6 +148,7 @@ namespace CloudMouse::Hardware
          * Call init() separately for actual hardware setup
          */
         EncoderManager();
+        ~EncoderManager();
 
         // ========================================================================
         // SYSTEM LIFECYCLE
@@ -142,8 +192,10 @@ namespace CloudMouse::Hardware
         /**
          * Get accumulated encoder movement and reset counter
          * Returns total rotation movement since last call and automatically resets to zero
+         * Movement is scaled by the acceleration curve: slow turns move one step per
+         * detent, fast spins several (see setAcceleration()).
          *
-         * @return Rotation delta in encoder clicks
+         * @return Rotation delta in (accelerated) encoder clicks
          *         Positive values = clockwise rotation
          *         Negative values = counter-clockwise rotation
          *         Zero = no movement since last call
@@ -256,6 +308,59 @@ namespace CloudMouse::Hardware
          */
         int getLastPressDuration() const;
 
+        // ========================================================================
+        // VELOCITY AND ACCELERATION
+        // ========================================================================
+
+        /**
+         * Current rotation speed from timestamped detents
+         *
+         * @return Smoothed detents per second, positive clockwise, 0 when idle
+         */
+        float getVelocity() const { return velocity.load(); }
+
+        /**
+         * Multiplier the curve currently applies (1.0 when idle or disabled)
+         */
+        float getMultiplier() const;
+
+        /**
+         * Un-accelerated detents since last call (auto-reset)
+         * For apps that apply their own velocity handling.
+         */
+        int getRawMovement() { return rawMovement.exchange(0); }
+
+        /**
+         * Replace the acceleration curve
+         *
+         * @param points Curve points sorted by ticksPerSecond (copied)
+         * @param count Number of points, at most ENCODER_ACCEL_MAX_POINTS
+         * @return false if the curve is empty or too long
+         */
+        bool setAcceleration(const EncoderAccelPoint *points, uint8_t count);
+
+        /**
+         * Enable or disable acceleration (disabled: one step per detent)
+         */
+        void setAccelerationEnabled(bool enabled) { accelEnabled.store(enabled); }
+        bool isAccelerationEnabled() const { return accelEnabled.load(); }
+
+        /**
+         * Slow the rotation sampler down while nothing is rendered
+         * Switches the sample timer between ENCODER_SAMPLE_INTERVAL_US and
+         * ENCODER_IDLE_SAMPLE_INTERVAL_US; no-op when the state is unchanged.
+         *
+         * @param idle true while the display is paused or asleep
+         */
+        void setIdleSampling(bool idle);
+
+        /**
+         * Accumulator read directly by the LVGL encoder callback
+         * Rotation is pushed by the sampler (esp_timer task), click / long-press
+         * events by update(), in addition to the consumption interface above.
+         */
+        EncoderInput &getInput() { return input; }
+
     private:
         // ========================================================================
         // HARDWARE INTERFACE
@@ -267,9 +372,23 @@ namespace CloudMouse::Hardware
         // ENCODER STATE MANAGEMENT
         // ========================================================================
 
-        int lastValue = 0;            // Last read encoder position
-        int movement = 0;             // Accumulated movement since last consumption
-        bool movementPending = false; // Flag indicating movement available for consumption
+        int lastValue = 0;                   // Last read encoder position (detents)
+        std::atomic<int> movement{0};        // Accelerated movement since last consumption
+        std::atomic<int> rawMovement{0};     // Detents since last getRawMovement()
+        EncoderInput input;                  // Direct path to LVGL (see EncoderInput.h)
+
+        // Velocity tracking (sampler context)
+        std::atomic<float> velocity{0.0f};   // Smoothed detents/s, signed
+        int64_t lastDetentUs = 0;            // Timestamp of the last detent
+        float accelCarry = 0.0f;             // Fractional accelerated steps not yet reported
+        esp_timer_handle_t sampleTimer = nullptr;
+        bool idleSampling = false;           // Sampler running at the idle period
+
+        // Acceleration curve (read on the sampler, replaced from any task)
+        mutable portMUX_TYPE accelMux = portMUX_INITIALIZER_UNLOCKED;
+        EncoderAccelPoint accelCurve[ENCODER_ACCEL_MAX_POINTS];
+        uint8_t accelPoints = 0;
+        std::atomic<bool> accelEnabled{true};
 
         // ========================================================================
         // BUTTON STATE MANAGEMENT
@@ -302,11 +421,19 @@ namespace CloudMouse::Hardware
 
         /**
          * Process encoder rotation and accumulate movement
-         * Reads PCNT position, calculates delta, and updates movement accumulator
-         * Called internally by update() method
+         * Reads PCNT position, timestamps new detents, updates velocity and feeds
+         * accelerated steps into the movement accumulators
+         * Called from the sample timer, or from update() when the timer is unavailable
          */
         void processEncoder();
 
+        /**
+         * Curve lookup for a speed in detents/s (takes accelMux)
+         */
+        float multiplierFor(float ticksPerSecond) const;
+
+        static void sampleTimerCb(void *arg);
+
         /**
          * Process button state changes and detect press events
          * Handles press/release detection, timing analysis, and event flag setting
@@ -0,0 +1,161 @@
+/**
+ * CloudMouse SDK - RAM Glyph Cache Implementation
+ */
+
+#include "./FontCache.h"
+#include <esp_heap_caps.h>
+
+namespace CloudMouse::Hardware
+{
+    FontCache::~FontCache()
+    {
+        for (uint8_t i = 0; i < count; i++)
+        {
+            heap_caps_free(entries[i].bitmap);
+            entries[i].bitmap = nullptr;
+        }
+    }
+
+    // ============================================================================
+    // FONT LAYOUT
+    // ============================================================================
+
+    uint32_t FontCache::glyphCount(const lv_font_fmt_txt_dsc_t *dsc)
+    {
+        uint32_t glyphs = 0;
+
+        for (uint16_t i = 0; i < dsc->cmap_num; i++)
+        {
+            const lv_font_fmt_txt_cmap_t &cmap = dsc->cmaps[i];
+            uint32_t last = 0;
+
+            switch (cmap.type)
+            {
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+                last = cmap.glyph_id_start + cmap.range_length;
+                break;
+
+            case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+                for (uint32_t j = 0; j < cmap.range_length; j++)
+                {
+                    uint32_t id = cmap.glyph_id_start + ((const uint8_t *)cmap.glyph_id_ofs_list)[j] + 1;
+                    if (id > last) last = id;
+                }
+                break;
+
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+                last = cmap.glyph_id_start + cmap.list_length;
+                break;
+
+            case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+                for (uint32_t j = 0; j < cmap.list_length; j++)
+                {
+                    uint32_t id = cmap.glyph_id_start + ((const uint16_t *)cmap.glyph_id_ofs_list)[j] + 1;
+                    if (id > last) last = id;
+                }
+                break;
+            }
+
+            if (last > glyphs) glyphs = last;
+        }
+
+        return glyphs;
+    }
+
+    size_t FontCache::bitmapSize(const lv_font_fmt_txt_dsc_t *dsc, uint32_t glyphs)
+    {
+        size_t end = 0;
+
+        // Glyph 0 is reserved; bitmaps are packed back to back in glyph order
+        for (uint32_t id = 1; id < glyphs; id++)
+        {
+            const lv_font_fmt_txt_glyph_dsc_t &g = dsc->glyph_dsc[id];
+            size_t bytes = ((size_t)g.box_w * g.box_h * dsc->bpp + 7) / 8;
+            if (g.bitmap_index + bytes > end) end = g.bitmap_index + bytes;
+        }
+
+        return end;
+    }
+
+    // ============================================================================
+    // CACHE MANAGEMENT
+    // ============================================================================
+
+    const lv_font_t *FontCache::add(const lv_font_t *font)
+    {
+        if (!font || count >= FONT_CACHE_MAX_FONTS) return font;
+
+        // Only built-in bitmap fonts in the plain layout can be copied verbatim
+        if (font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt) return font;
+        const lv_font_fmt_txt_dsc_t *dsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
+        if (!dsc || dsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN) return font;
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (entries[i].source == font) return &entries[i].font;
+        }
+
+        const uint32_t glyphs = glyphCount(dsc);
+        const size_t bytes = bitmapSize(dsc, glyphs);
+
+        if (cachedBytes + bytes > FONT_CACHE_BUDGET)
+        {
+            Serial.printf("⚠️ FontCache: %d px font needs %u bytes, over budget - using flash\n",
+                          (int)font->line_height, (unsigned)bytes);
+            return font;
+        }
+
+        uint8_t *bitmap = (uint8_t *)heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!bitmap)
+        {
+            Serial.println("⚠️ FontCache: allocation failed - using flash");
+            return font;
+        }
+        memcpy(bitmap, dsc->glyph_bitmap, bytes);
+
+        Entry &entry = entries[count++];
+        entry.source = font;
+        entry.dsc = *dsc;
+        entry.dsc.glyph_bitmap = enabled ? bitmap : dsc->glyph_bitmap;
+        entry.font = *font;
+        entry.font.dsc = &entry.dsc;
+        entry.bitmap = bitmap;
+        entry.bitmapBytes = bytes;
+        entry.glyphs = glyphs;
+        cachedBytes += bytes;
+
+        Serial.printf("✅ FontCache: %d px font, %lu glyphs, %u bytes in RAM\n",
+                      (int)font->line_height, (unsigned long)glyphs, (unsigned)bytes);
+        return &entry.font;
+    }
+
+    void FontCache::setEnabled(bool value)
+    {
+        enabled = value;
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            const lv_font_fmt_txt_dsc_t *original = (const lv_font_fmt_txt_dsc_t *)entries[i].source->dsc;
+            entries[i].dsc.glyph_bitmap = enabled ? entries[i].bitmap : original->glyph_bitmap;
+        }
+    }
+
+    // ============================================================================
+    // REPORTING
+    // ============================================================================
+
+    void FontCache::print() const
+    {
+        Serial.printf("🔤 Font cache: %u font(s), %u / %u bytes, %s\n",
+                      count, (unsigned)cachedBytes, (unsigned)FONT_CACHE_BUDGET,
+                      enabled ? "RAM" : "flash (disabled)");
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            const Entry &e = entries[i];
+            Serial.printf("   %-3d px  %-5lu glyphs  %u bytes\n",
+                          (int)e.font.line_height, (unsigned long)e.glyphs, (unsigned)e.bitmapBytes);
+        }
+    }
+
+} // namespace CloudMouse::Hardware
@@ -0,0 +1,92 @@
+/**
+ * CloudMouse SDK - RAM Glyph Cache for LVGL Fonts
+ *
+ * Large glyphs are read straight from flash through the 32 KB flash cache on every
+ * draw; a title in a 28 px font touches kilobytes of bitmap data per label and evicts
+ * other hot code and rodata. FontCache clones selected fonts into RAM so their glyph
+ * bitmaps are read from internal memory instead.
+ *
+ * How It Works:
+ * - add() copies the font descriptor and the whole glyph bitmap array into internal
+ *   RAM and returns a clone that is used in place of the original font
+ * - Only plain (uncompressed) lv_font_fmt_txt fonts are cloned; the budget is sized
+ *   from the generated subset fonts, so all of them fit. The full 28 px Montserrat
+ *   does not fit the 16 KB fallback budget and stays in flash
+ * - Fonts that do not fit FONT_CACHE_BUDGET are returned unchanged
+ * - setEnabled(false) points the clones back at flash, for A/B render benchmarks
+ *
+ * Thread Safety:
+ * - UI task only; clones must outlive every label that uses them
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "UiFonts.h"
+
+// Maximum number of cloned fonts
+#define FONT_CACHE_MAX_FONTS 4
+
+// Internal RAM that may be spent on cached glyph bitmaps: every generated subset font
+// (size reported by tools/fonts/subset_fonts.py, plus headroom for descriptor
+// alignment), 16 KB when the full built-in fonts are in use
+#ifndef FONT_CACHE_BUDGET
+#ifdef UI_FONTS_BITMAP_BYTES
+#define FONT_CACHE_BUDGET (UI_FONTS_BITMAP_BYTES + 1024U)
+#else
+#define FONT_CACHE_BUDGET (16U * 1024U)
+#endif
+#endif
+
+namespace CloudMouse::Hardware
+{
+    class FontCache
+    {
+    public:
+        ~FontCache();
+
+        /**
+         * Clone a font with its glyph bitmaps in internal RAM
+         *
+         * @param font Font to cache (typically a subset font)
+         * @return RAM-backed clone, or font itself if it cannot be cached
+         */
+        const lv_font_t *add(const lv_font_t *font);
+
+        /**
+         * Switch clones between RAM bitmaps (true) and the original flash data (false)
+         * Labels must be invalidated by the caller to see the effect.
+         */
+        void setEnabled(bool enabled);
+        bool isEnabled() const { return enabled; }
+
+        size_t getCachedBytes() const { return cachedBytes; }
+        uint8_t getCount() const { return count; }
+
+        /**
+         * Print cached fonts and RAM usage to Serial
+         */
+        void print() const;
+
+    private:
+        struct Entry
+        {
+            const lv_font_t *source = nullptr;
+            lv_font_t font;
+            lv_font_fmt_txt_dsc_t dsc;
+            uint8_t *bitmap = nullptr;
+            size_t bitmapBytes = 0;
+            uint32_t glyphs = 0;
+        };
+
+        Entry entries[FONT_CACHE_MAX_FONTS];
+        uint8_t count = 0;
+        size_t cachedBytes = 0;
+        bool enabled = true;
+
+        static uint32_t glyphCount(const lv_font_fmt_txt_dsc_t *dsc);
+        static size_t bitmapSize(const lv_font_fmt_txt_dsc_t *dsc, uint32_t glyphs);
+    };
+
+} // namespace CloudMouse::Hardware
@@ -0,0 +1,148 @@
+/**
+ * CloudMouse SDK - In-Memory Framebuffer Display (Host Builds)
+ *
+ * Drop-in replacement for LGFX_ILI9488 used when the SDK is compiled for a Linux host
+ * (CLOUDMOUSE_HOST_BUILD). Implements the subset of the LovyanGFX device interface used
+ * by DisplayManager and keeps the panel contents in a 480x320 RGB565 framebuffer that
+ * can be dumped to PPM for inspection and regression testing.
+ *
+ * Behaviour:
+ * - pushImage()/pushImageDMA() copy synchronously (waitDMA() is a no-op)
+ * - 3-byte panel-format pixels (lgfx::bgr888_t, wire order R,G,B) are folded back to
+ *   RGB565, so the host exercises the same staged conversion path as the device
+ * - Brightness is recorded but not applied to the framebuffer
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+
+// LovyanGFX colour constants referenced by the UI code (RGB565)
+#ifndef TFT_BLACK
+#define TFT_BLACK 0x0000
+#define TFT_DARKGREEN 0x03E0
+#define TFT_DARKGRAY 0x7BEF
+#endif
+
+namespace lgfx
+{
+    /**
+     * Panel-native 3-byte pixel, stored in wire order (R, G, B)
+     */
+    struct bgr888_t
+    {
+        uint8_t r;
+        uint8_t g;
+        uint8_t b;
+    };
+}
+
+class FramebufferDisplay
+{
+public:
+    static const int WIDTH = 480;
+    static const int HEIGHT = 320;
+
+    void init() { fillScreen(TFT_BLACK); }
+    void setBrightness(uint8_t value) { brightness = value; }
+    uint8_t getBrightness() const { return brightness; }
+
+    // Panel sleep (SLPIN/SLPOUT) is only recorded
+    void sleep() { sleeping = true; }
+    void wakeup() { sleeping = false; }
+    bool isSleeping() const { return sleeping; }
+
+    // Bus transaction and DMA control are no-ops on the host
+    void startWrite() {}
+    void endWrite() {}
+    void waitDMA() {}
+
+    void fillScreen(uint16_t color)
+    {
+        for (int i = 0; i < WIDTH * HEIGHT; i++)
+        {
+            framebuffer[i] = color;
+        }
+    }
+
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data)
+    {
+        for (int32_t row = 0; row < h; row++)
+        {
+            if (y + row < 0 || y + row >= HEIGHT) continue;
+            for (int32_t col = 0; col < w; col++)
+            {
+                if (x + col < 0 || x + col >= WIDTH) continue;
+                framebuffer[(y + row) * WIDTH + x + col] = data[row * w + col];
+            }
+        }
+        pushedPixels += (uint32_t)w * h;
+    }
+
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data)
+    {
+        pushImage(x, y, w, h, data);
+    }
+
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, const lgfx::bgr888_t *data)
+    {
+        for (int32_t row = 0; row < h; row++)
+        {
+            if (y + row < 0 || y + row >= HEIGHT) continue;
+            for (int32_t col = 0; col < w; col++)
+            {
+                if (x + col < 0 || x + col >= WIDTH) continue;
+                const lgfx::bgr888_t &p = data[row * w + col];
+                framebuffer[(y + row) * WIDTH + x + col] =
+                    ((p.r >> 3) << 11) | ((p.g >> 2) << 5) | (p.b >> 3);
+            }
+        }
+        pushedPixels += (uint32_t)w * h;
+    }
+
+    // ========================================================================
+    // HOST INSPECTION
+    // ========================================================================
+
+    const uint16_t *getFramebuffer() const { return framebuffer; }
+    uint16_t getPixel(int32_t x, int32_t y) const { return framebuffer[y * WIDTH + x]; }
+    uint32_t getPushedPixels() const { return pushedPixels; }
+
+    /**
+     * Write framebuffer as binary PPM (P6, 8 bits per channel)
+     *
+     * @param path Output file path
+     * @return true on success
+     */
+    bool writePPM(const char *path) const
+    {
+        FILE *f = fopen(path, "wb");
+        if (!f) return false;
+
+        fprintf(f, "P6\n%d %d\n255\n", WIDTH, HEIGHT);
+        uint8_t rgb[WIDTH * 3];
+        for (int y = 0; y < HEIGHT; y++)
+        {
+            for (int x = 0; x < WIDTH; x++)
+            {
+                uint16_t px = framebuffer[y * WIDTH + x];
+                uint8_t r = (px >> 11) & 0x1F, g = (px >> 5) & 0x3F, b = px & 0x1F;
+                rgb[x * 3 + 0] = (r << 3) | (r >> 2);
+                rgb[x * 3 + 1] = (g << 2) | (g >> 4);
+                rgb[x * 3 + 2] = (b << 3) | (b >> 2);
+            }
+            fwrite(rgb, 1, sizeof(rgb), f);
+        }
+
+        fclose(f);
+        return true;
+    }
+
+private:
+    uint16_t framebuffer[WIDTH * HEIGHT];
+    uint8_t brightness = 0;
+    bool sleeping = false;
+    uint32_t pushedPixels = 0;
+};
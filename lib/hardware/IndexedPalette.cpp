@@ -0,0 +1,137 @@
+/**
+ * CloudMouse SDK - Indexed Colour Palette Implementation
+ *
+ * Expansion layout (little-endian): each LUT entry holds the three wire bytes of one
+ * pixel, four entries are packed into three 32-bit output words:
+ *   out0 = P0 | P1 << 24
+ *   out1 = P1 >> 8 | P2 << 16
+ *   out2 = P2 >> 16 | P3 << 8
+ */
+
+#include "./IndexedPalette.h"
+#include "./PixelConverter.h"
+
+namespace CloudMouse::Hardware
+{
+    void IndexedPalette::clear()
+    {
+        count = 0;
+        build();
+    }
+
+    bool IndexedPalette::add(uint32_t hex)
+    {
+        const uint8_t value = lv_color_luminance(lv_color_hex(hex));
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (entries[i].value != value) continue;
+            if (lv_color_to_u16(lv_color_hex(entries[i].hex)) == lv_color_to_u16(lv_color_hex(hex))) return true;
+
+            Serial.printf("⚠️ Palette: #%06lX has the luminance of #%06lX (%u) and renders as it\n",
+                          (unsigned long)hex, (unsigned long)entries[i].hex, value);
+            return false;
+        }
+
+        if (count >= MAX_COLORS)
+        {
+            Serial.printf("⚠️ Palette full (%u colours), #%06lX not added\n", MAX_COLORS, (unsigned long)hex);
+            return false;
+        }
+
+        // Keep entries sorted by L8 value for interpolation
+        uint8_t pos = count;
+        while (pos > 0 && entries[pos - 1].value > value)
+        {
+            entries[pos] = entries[pos - 1];
+            pos--;
+        }
+        entries[pos] = {hex, value};
+        count++;
+
+        build();
+        return true;
+    }
+
+    void IndexedPalette::build()
+    {
+        // End points: black and white unless a palette colour already sits there
+        lv_color_t low = lv_color_hex(0x000000);
+        lv_color_t high = lv_color_hex(0xFFFFFF);
+        uint8_t lowValue = 0;
+
+        uint8_t next = 0;
+        for (int v = 0; v < 256; v++)
+        {
+            lv_color_t color;
+            if (next < count && entries[next].value == v)
+            {
+                // Exact palette colour
+                color = lv_color_hex(entries[next].hex);
+                low = color;
+                lowValue = v;
+                next++;
+            }
+            else
+            {
+                // Anti-aliased value between two palette colours
+                const lv_color_t upper = next < count ? lv_color_hex(entries[next].hex) : high;
+                const int upperValue = next < count ? entries[next].value : 255;
+                const int span = upperValue - lowValue;
+                const int t = v - lowValue;
+
+                color.red = (uint8_t)((low.red * (span - t) + upper.red * t + span / 2) / span);
+                color.green = (uint8_t)((low.green * (span - t) + upper.green * t + span / 2) / span);
+                color.blue = (uint8_t)((low.blue * (span - t) + upper.blue * t + span / 2) / span);
+            }
+
+            lut565[v] = lv_color_to_u16(color);
+
+            uint8_t wire[3];
+            PixelConverter::rgb565ToRgb666Reference(wire, &lut565[v], 1, false);
+            lut666[v] = wire[0] | (wire[1] << 8) | (wire[2] << 16);
+        }
+    }
+
+    void IndexedPalette::expandRgb666(uint8_t *dst, const uint8_t *src, size_t pixels) const
+    {
+        uint32_t *out = (uint32_t *)dst;
+        const size_t blocks = pixels / 4;
+
+        for (size_t i = 0; i < blocks; i++)
+        {
+            const uint32_t p0 = lut666[src[0]];
+            const uint32_t p1 = lut666[src[1]];
+            const uint32_t p2 = lut666[src[2]];
+            const uint32_t p3 = lut666[src[3]];
+            src += 4;
+
+            out[0] = p0 | (p1 << 24);
+            out[1] = (p1 >> 8) | (p2 << 16);
+            out[2] = (p2 >> 16) | (p3 << 8);
+            out += 3;
+        }
+
+        // Remaining 0-3 pixels
+        dst = (uint8_t *)out;
+        for (size_t i = 0; i < pixels % 4; i++)
+        {
+            const uint32_t p = lut666[src[i]];
+            dst[0] = (uint8_t)p;
+            dst[1] = (uint8_t)(p >> 8);
+            dst[2] = (uint8_t)(p >> 16);
+            dst += 3;
+        }
+    }
+
+    void IndexedPalette::print() const
+    {
+        Serial.printf("🎨 Indexed palette: %u colours (+ black/white end points)\n", count);
+        for (uint8_t i = 0; i < count; i++)
+        {
+            Serial.printf("   #%06lX -> L8 %3u -> RGB565 0x%04X\n",
+                          (unsigned long)entries[i].hex, entries[i].value, lut565[entries[i].value]);
+        }
+    }
+
+} // namespace CloudMouse::Hardware
@@ -0,0 +1,89 @@
+/**
+ * CloudMouse SDK - Indexed Colour Palette (L8 Render Mode)
+ *
+ * In indexed mode LVGL renders into 8-bit L8 bands (one byte per pixel, half the
+ * RGB565 buffer size) and the flush callback expands every byte through a 256-entry
+ * LUT straight to the panel's 3-byte format. LVGL stores the luminance of each style
+ * colour in L8, so the LUT maps the luminance of every palette colour back to that
+ * colour and interpolates between neighbouring palette entries for anti-aliased edges.
+ *
+ * Palette Rules:
+ * - Register every theme colour with add(); two colours with the same luminance
+ *   cannot be told apart and the second one is rejected
+ * - Pure black (0) and white (255) are implicit end points, so monochrome images
+ *   such as QR codes keep their contrast
+ *
+ * Output:
+ * - Flat fills in palette colours come out bit-exact with RGB565 rendering (same
+ *   RGB565 truncation and PixelConverter widening)
+ *
+ * Limitations (indexed output is not RGB565-equivalent beyond flat fills):
+ * - Anti-aliased edges blend along the luminance ramp, not between the two colours
+ *   that meet: text or an arc edge can pick up a coloured fringe from whatever palette
+ *   colour lies between them in luminance
+ * - Colours not in the palette, images and gradients snap to the palette colour of
+ *   the same luminance
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+namespace CloudMouse::Hardware
+{
+    class IndexedPalette
+    {
+    public:
+        static const uint8_t MAX_COLORS = 24;
+
+        IndexedPalette() { clear(); }
+
+        /**
+         * Drop all colours; the LUT becomes a plain grey ramp
+         */
+        void clear();
+
+        /**
+         * Register a palette colour (lv_color_hex value) and rebuild the LUT
+         *
+         * @return false if the palette is full or another colour has the same luminance
+         */
+        bool add(uint32_t hex);
+
+        uint8_t getCount() const { return count; }
+
+        /**
+         * Colour of an L8 value as native RGB565 (capture, host framebuffer)
+         */
+        uint16_t toRgb565(uint8_t value) const { return lut565[value]; }
+        const uint16_t *getRgb565Lut() const { return lut565; }
+
+        /**
+         * Expand L8 pixels to the panel's 3-byte RGB666 format (4 pixels per iteration)
+         *
+         * @param dst Destination, 3 * pixels bytes, 4-byte aligned
+         * @param src L8 pixels
+         * @param pixels Number of pixels
+         */
+        void expandRgb666(uint8_t *dst, const uint8_t *src, size_t pixels) const;
+
+        void print() const;
+
+    private:
+        struct Entry
+        {
+            uint32_t hex;
+            uint8_t value; // L8 luminance LVGL renders for this colour
+        };
+
+        Entry entries[MAX_COLORS];
+        uint8_t count = 0;
+
+        uint16_t lut565[256];
+        uint32_t lut666[256]; // Wire bytes R | G << 8 | B << 16
+
+        void build();
+    };
+
+} // namespace CloudMouse::Hardware
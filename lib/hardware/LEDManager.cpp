@@ -6,12 +6,14 @@
  */
 
 #include "./LEDManager.h"
+#include "../utils/Clock.h"
 #include <string>
 
 namespace CloudMouse::Hardware
 {
 
     using CloudMouse::Prefs::PreferencesManager;
+    using CloudMouse::Utils::Clock;
 
     // ============================================================================
     // SYSTEM INITIALIZATION
@@ -141,7 +143,7 @@ namespace CloudMouse::Hardware
                 loading = event.state;
                 if (loading)
                 {
-                    lastEncMovementTime = millis();
+                    lastEncMovementTime = Clock::nowMs();
                     pulsating = false;
                     fading = false;
                     setAllLEDs(244, 70, 17); // Orange loading color
@@ -159,7 +161,7 @@ namespace CloudMouse::Hardware
                 fading = false;
                 flash = true;
                 flashDuration = event.duration;
-                lastFlashStarted = millis();
+                lastFlashStarted = Clock::nowMs();
                 currentBrightness = event.brightness;
 
                 strip.setBrightness(event.brightness);
@@ -170,7 +172,7 @@ namespace CloudMouse::Hardware
             case LEDEventType::ACTIVATE:
                 if (!loading)
                 {
-                    lastEncMovementTime = millis();
+                    lastEncMovementTime = Clock::nowMs();
                 }
                 pulsating = false;
                 fading = false;
@@ -206,7 +208,7 @@ namespace CloudMouse::Hardware
 
     void LEDManager::updateAnimations()
     {
-        unsigned long currentMillis = millis();
+        unsigned long currentMillis = Clock::nowMs();
 
         // Animation priority order:
         // 1. Fade (smooth transitions)
@@ -265,7 +267,7 @@ namespace CloudMouse::Hardware
 
     void LEDManager::updateInitAnimation()
     {
-        unsigned long currentMillis = millis();
+        unsigned long currentMillis = Clock::nowMs();
 
         // Boot sequence: LED sweep animation
         if (!inited && currentMillis - previousMillis >= ANIMATION_INTERVAL)
@@ -344,9 +346,9 @@ namespace CloudMouse::Hardware
         static bool pulseUp = true;
 
         // Gentle breathing animation for idle state
-        if (millis() - lastPulseUpdate > 100)
+        if (Clock::nowMs() - lastPulseUpdate > 100)
         { // 10Hz pulsating
-            lastPulseUpdate = millis();
+            lastPulseUpdate = Clock::nowMs();
 
             if (pulseUp)
             {
@@ -376,7 +378,7 @@ namespace CloudMouse::Hardware
     void LEDManager::updateFlashAnimation()
     {
         // Simple flash timer
-        if (millis() - lastFlashStarted >= flashDuration)
+        if (Clock::nowMs() - lastFlashStarted >= flashDuration)
         {
             flash = false;
             flashDuration = 0;
@@ -387,7 +389,7 @@ namespace CloudMouse::Hardware
 
     void LEDManager::updateFadeAnimation()
     {
-        unsigned long elapsedTime = millis() - fadeStartMillis;
+        unsigned long elapsedTime = Clock::nowMs() - fadeStartMillis;
 
         if (elapsedTime <= fadeDuration)
         {
@@ -558,7 +560,7 @@ namespace CloudMouse::Hardware
         targetBrightness = brightness;
         if (!fading)
         {
-            fadeStartMillis = millis();
+            fadeStartMillis = Clock::nowMs();
         }
         fadeDuration = duration;
         fading = true;
@@ -40,14 +40,14 @@
  * - Extends LGFX_Device base class for hardware acceleration
  * - Configures Panel_ILI9488 for optimal register settings
  * - Sets up Bus_SPI with DMA channel allocation
- * - Implements Light_PWM for smooth brightness control
+ * - Backlight is owned by Backlight (LEDC hardware fades) unless LGFX_BACKLIGHT_PWM is set
  * - Custom orientation control for BGR color correction
  * 
  * Usage Pattern:
  * 1. Instantiate LGFX_ILI9488 display object
  * 2. Call init() to configure hardware and power management
  * 3. Use standard LovyanGFX drawing methods for graphics
- * 4. Call setBrightness() for backlight adjustment
+ * 4. Drive the backlight with Backlight (or setBrightness() with LGFX_BACKLIGHT_PWM)
  * 5. Utilize sprite buffers for flicker-free animations
  */
 
@@ -61,6 +61,15 @@
 #define TFT_BL 8    // PWM backlight control pin
 #define TFT_PWR 1   // Power enable pin (PCB version dependent)
 
+/**
+ * Backlight ownership: DisplayManager drives TFT_BL through Backlight (LEDC hardware
+ * fades). Define LGFX_BACKLIGHT_PWM 1 to let LovyanGFX own the pin instead when this
+ * class is used standalone (setBrightness()).
+ */
+#ifndef LGFX_BACKLIGHT_PWM
+#define LGFX_BACKLIGHT_PWM 0
+#endif
+
 // SPI host definition for ESP32-S3 compatibility
 #ifndef HSPI_HOST
 #define HSPI_HOST SPI2_HOST
@@ -90,7 +99,9 @@ class LGFX_ILI9488 : public lgfx::LGFX_Device {
     // LovyanGFX component instances for hardware abstraction
     lgfx::Panel_ILI9488 _panel_instance;    // ILI9488 panel controller
     lgfx::Bus_SPI _bus_instance;            // SPI bus configuration
+#if LGFX_BACKLIGHT_PWM
     lgfx::Light_PWM _light_instance;        // PWM backlight controller
+#endif
 
 public:
     /**
@@ -161,6 +172,7 @@ public:
         // BACKLIGHT CONFIGURATION
         // ====================================================================
         
+#if LGFX_BACKLIGHT_PWM
         auto light_cfg = _light_instance.config();
         
         // PWM backlight control settings
@@ -172,6 +184,7 @@ public:
         // Apply backlight configuration and link to panel
         _light_instance.config(light_cfg);
         _panel_instance.setLight(&_light_instance);
+#endif
 
         // Link panel to device instance
         setPanel(&_panel_instance);
@@ -281,14 +294,18 @@ public:
         // Clear display to black background for clean startup
         fillScreen(TFT_BLACK);
         
+#if LGFX_BACKLIGHT_PWM
         // Set moderate brightness for initial setup (40% of maximum)
         setBrightness(100);
+#endif
         
         Serial.println("✅ ILI9488 display initialized successfully");
         Serial.printf("   Resolution: 480x320 pixels\n");
         Serial.printf("   Color depth: 16-bit RGB565\n");
         Serial.printf("   SPI frequency: 40MHz write, 16MHz read\n");
+#if LGFX_BACKLIGHT_PWM
         Serial.printf("   PWM backlight: 5KHz @ channel 7\n");
+#endif
         Serial.printf("   Power management: PCB v%d compatible\n", PCB_VERSION);
     }
 };
@@ -0,0 +1,278 @@
+/**
+ * CloudMouse SDK - Split-Pool LVGL Memory Backend Implementation
+ */
+
+#include "./LvglAllocator.h"
+#include <lvgl_private.h> // lv_draw_buf_handlers_t
+#include <esp_heap_caps.h>
+#include <esp_memory_utils.h>
+
+namespace CloudMouse::Hardware
+{
+    LvglPoolStats LvglAllocator::stats[2];
+
+    // ============================================================================
+    // PLACEMENT
+    // ============================================================================
+
+    uint32_t LvglAllocator::capsOf(LvglPool pool)
+    {
+        return pool == LvglPool::PSRAM ? (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+                                       : (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    }
+
+    LvglPool LvglAllocator::poolOf(void *ptr)
+    {
+        return esp_ptr_external_ram(ptr) ? LvglPool::PSRAM : LvglPool::INTERNAL;
+    }
+
+    LvglPool LvglAllocator::choosePool(size_t size)
+    {
+        if (size >= LVGL_ALLOC_PSRAM_THRESHOLD) return LvglPool::PSRAM;
+
+        const LvglPoolStats &internal = stats[(int)LvglPool::INTERNAL];
+        if (internal.usedBytes + size > LVGL_ALLOC_INTERNAL_BUDGET) return LvglPool::PSRAM;
+
+        return LvglPool::INTERNAL;
+    }
+
+    void LvglAllocator::noteAllocated(void *ptr)
+    {
+        LvglPoolStats &s = stats[(int)poolOf(ptr)];
+        s.usedBytes += heap_caps_get_allocated_size(ptr);
+        s.blocks++;
+        if (s.usedBytes > s.peakBytes) s.peakBytes = s.usedBytes;
+    }
+
+    void LvglAllocator::noteReleased(LvglPool pool, size_t bytes)
+    {
+        LvglPoolStats &s = stats[(int)pool];
+        s.usedBytes -= bytes;
+        s.blocks--;
+    }
+
+    // ============================================================================
+    // LVGL HOOKS
+    // ============================================================================
+
+    void *LvglAllocator::allocate(size_t size)
+    {
+        if (size == 0) return nullptr;
+        return allocateFrom(choosePool(size), size);
+    }
+
+    void *LvglAllocator::allocateFrom(LvglPool preferred, size_t size)
+    {
+        const LvglPool other = preferred == LvglPool::PSRAM ? LvglPool::INTERNAL : LvglPool::PSRAM;
+
+        void *ptr = heap_caps_malloc(size, capsOf(preferred));
+        if (!ptr)
+        {
+            stats[(int)preferred].failures++;
+            ptr = heap_caps_malloc(size, capsOf(other));
+            if (!ptr)
+            {
+                stats[(int)other].failures++;
+                return nullptr;
+            }
+        }
+
+        noteAllocated(ptr);
+        stats[(int)poolOf(ptr)].allocations++;
+        return ptr;
+    }
+
+    void *LvglAllocator::reallocate(void *ptr, size_t size)
+    {
+        if (!ptr) return allocate(size);
+        if (size == 0)
+        {
+            release(ptr);
+            return nullptr;
+        }
+
+        const LvglPool oldPool = poolOf(ptr);
+        const size_t oldBytes = heap_caps_get_allocated_size(ptr);
+
+        // heap_caps_realloc() moves the block when it must change region
+        const LvglPool preferred = choosePool(size);
+        void *moved = heap_caps_realloc(ptr, size, capsOf(preferred));
+        if (!moved)
+        {
+            stats[(int)preferred].failures++;
+            const LvglPool other = preferred == LvglPool::PSRAM ? LvglPool::INTERNAL : LvglPool::PSRAM;
+            moved = heap_caps_realloc(ptr, size, capsOf(other));
+            if (!moved)
+            {
+                stats[(int)other].failures++;
+                return nullptr; // Original block is untouched
+            }
+        }
+
+        noteReleased(oldPool, oldBytes);
+        noteAllocated(moved);
+        return moved;
+    }
+
+    void LvglAllocator::release(void *ptr)
+    {
+        if (!ptr) return;
+
+        noteReleased(poolOf(ptr), heap_caps_get_allocated_size(ptr));
+        heap_caps_free(ptr);
+    }
+
+    // ============================================================================
+    // DRAW BUFFERS
+    // ============================================================================
+
+    void *LvglAllocator::allocateDrawBuf(size_t size, lv_color_format_t format)
+    {
+        LV_UNUSED(format);
+        if (size == 0) return nullptr;
+
+        // Same slack as LVGL's default handler, the caller aligns the pointer afterwards
+        size += LV_DRAW_BUF_ALIGN - 1;
+        return allocateFrom(size <= LVGL_DRAW_BUF_INTERNAL_MAX ? LvglPool::INTERNAL : LvglPool::PSRAM, size);
+    }
+
+    void LvglAllocator::releaseDrawBuf(void *buf)
+    {
+        release(buf);
+    }
+
+    void LvglAllocator::installDrawBufHandlers()
+    {
+        for (lv_draw_buf_handlers_t *handlers : {lv_draw_buf_get_handlers(), lv_draw_buf_get_font_handlers()})
+        {
+            handlers->buf_malloc_cb = allocateDrawBuf;
+            handlers->buf_free_cb = releaseDrawBuf;
+        }
+    }
+
+    void LvglAllocator::monitor(lv_mem_monitor_t *mon)
+    {
+        memset(mon, 0, sizeof(*mon));
+
+        const LvglPoolStats &internal = stats[(int)LvglPool::INTERNAL];
+        const LvglPoolStats &psram = stats[(int)LvglPool::PSRAM];
+        const uint32_t used = internal.usedBytes + psram.usedBytes;
+
+        // LVGL's view: the internal budget plus whatever PSRAM is left
+        const uint32_t psramFree = heap_caps_get_free_size(capsOf(LvglPool::PSRAM));
+        const uint32_t internalFree = internal.usedBytes < LVGL_ALLOC_INTERNAL_BUDGET
+                                          ? LVGL_ALLOC_INTERNAL_BUDGET - internal.usedBytes
+                                          : 0;
+
+        mon->free_size = internalFree + psramFree;
+        mon->total_size = used + mon->free_size;
+        mon->free_biggest_size = heap_caps_get_largest_free_block(capsOf(LvglPool::PSRAM));
+        mon->used_cnt = internal.blocks + psram.blocks;
+        mon->max_used = internal.peakBytes + psram.peakBytes;
+        mon->used_pct = mon->total_size ? (uint8_t)(100ULL * used / mon->total_size) : 0;
+        mon->frag_pct = getFragmentation(LvglPool::INTERNAL);
+    }
+
+    // ============================================================================
+    // REPORTING
+    // ============================================================================
+
+    const LvglPoolStats &LvglAllocator::getStats(LvglPool pool)
+    {
+        return stats[(int)pool];
+    }
+
+    uint8_t LvglAllocator::getFragmentation(LvglPool pool)
+    {
+        const size_t freeBytes = heap_caps_get_free_size(capsOf(pool));
+        if (freeBytes == 0) return 0;
+
+        const size_t largest = heap_caps_get_largest_free_block(capsOf(pool));
+        return (uint8_t)(100 - (100ULL * largest / freeBytes));
+    }
+
+    const char *LvglAllocator::poolName(LvglPool pool)
+    {
+        return pool == LvglPool::PSRAM ? "psram" : "internal";
+    }
+
+    void LvglAllocator::print()
+    {
+        Serial.println("\n🧠 LVGL_MEMORY_START");
+        Serial.printf("  placement: >= %u bytes to PSRAM, internal budget %u bytes\n",
+                      (unsigned)LVGL_ALLOC_PSRAM_THRESHOLD, (unsigned)LVGL_ALLOC_INTERNAL_BUDGET);
+        Serial.printf("  draw buffers: internal up to %u bytes\n", (unsigned)LVGL_DRAW_BUF_INTERNAL_MAX);
+        Serial.println("  pool      used_B    peak_B    blocks  allocs    fails  heap_free  largest   frag");
+
+        for (LvglPool pool : {LvglPool::INTERNAL, LvglPool::PSRAM})
+        {
+            const LvglPoolStats &s = stats[(int)pool];
+            Serial.printf("  %-9s %-9lu %-9lu %-7lu %-9lu %-6lu %-10u %-9u %u%%\n",
+                          poolName(pool),
+                          (unsigned long)s.usedBytes, (unsigned long)s.peakBytes,
+                          (unsigned long)s.blocks, (unsigned long)s.allocations,
+                          (unsigned long)s.failures,
+                          (unsigned)heap_caps_get_free_size(capsOf(pool)),
+                          (unsigned)heap_caps_get_largest_free_block(capsOf(pool)),
+                          getFragmentation(pool));
+        }
+
+        Serial.println("🧠 LVGL_MEMORY_END\n");
+    }
+
+} // namespace CloudMouse::Hardware
+
+// ============================================================================
+// LVGL CUSTOM STDLIB ENTRY POINTS (LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM)
+// ============================================================================
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+
+using CloudMouse::Hardware::LvglAllocator;
+
+extern "C"
+{
+    void lv_mem_init(void) {}
+
+    void lv_mem_deinit(void) {}
+
+    // Both pools are the system heaps; extra pools are not supported
+    lv_mem_pool_t lv_mem_add_pool(void *mem, size_t bytes)
+    {
+        LV_UNUSED(mem);
+        LV_UNUSED(bytes);
+        return NULL;
+    }
+
+    void lv_mem_remove_pool(lv_mem_pool_t pool)
+    {
+        LV_UNUSED(pool);
+    }
+
+    void *lv_malloc_core(size_t size)
+    {
+        return LvglAllocator::allocate(size);
+    }
+
+    void *lv_realloc_core(void *p, size_t new_size)
+    {
+        return LvglAllocator::reallocate(p, new_size);
+    }
+
+    void lv_free_core(void *p)
+    {
+        LvglAllocator::release(p);
+    }
+
+    void lv_mem_monitor_core(lv_mem_monitor_t *mon_p)
+    {
+        LvglAllocator::monitor(mon_p);
+    }
+
+    lv_result_t lv_mem_test_core(void)
+    {
+        return heap_caps_check_integrity_all(true) ? LV_RESULT_OK : LV_RESULT_INVALID;
+    }
+}
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * CloudMouse SDK - Split-Pool LVGL Memory Backend
+ *
+ * Replaces LVGL's fixed LV_MEM_SIZE pool (enabled with LV_USE_STDLIB_MALLOC set to
+ * LV_STDLIB_CUSTOM in lv_conf.h). Allocations are routed by size between two heap_caps
+ * regions of the system heap. Arduino-ESP32 2.x ships ESP-IDF 4.4, whose heap is the
+ * multi_heap first-fit allocator (TLSF only arrived in ESP-IDF 5.0), so fragmentation is
+ * tracked per pool rather than assumed away:
+ *
+ * - INTERNAL: small, hot objects (lv_obj_t, styles, event lists, short strings)
+ * - PSRAM: large, rarely touched blocks (image/QR buffers, long label text, caches)
+ *
+ * Placement Rules:
+ * - size >= LVGL_ALLOC_PSRAM_THRESHOLD goes to PSRAM
+ * - smaller blocks stay internal until LVGL holds LVGL_ALLOC_INTERNAL_BUDGET bytes there,
+ *   after which they spill to PSRAM so WiFi/BLE keep their internal heap
+ * - if the preferred pool is exhausted the other one is tried before failing
+ * - draw buffers (layers, masks, glyph bitmaps) bypass the size rule: they are written
+ *   pixel by pixel while rendering, so they come from internal RAM up to
+ *   LVGL_DRAW_BUF_INTERNAL_MAX and outside the budget, PSRAM only as fallback
+ *   (installed with installDrawBufHandlers() after lv_init())
+ *
+ * Statistics:
+ * - Live bytes, peak bytes, live block count, total allocations and failures per pool
+ * - Heap free / largest block / fragmentation of the underlying ESP-IDF region
+ * - lv_mem_monitor() reports the combined view, so existing LVGL tooling keeps working
+ *
+ * Thread Safety:
+ * - Allocation hooks run on the UI task only (LVGL is single-threaded)
+ * - Counters are 32-bit and may be read from other tasks for reporting
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// Blocks of this size or larger are placed in PSRAM
+#ifndef LVGL_ALLOC_PSRAM_THRESHOLD
+#define LVGL_ALLOC_PSRAM_THRESHOLD 512
+#endif
+
+// Internal RAM LVGL may hold before small blocks spill to PSRAM
+#ifndef LVGL_ALLOC_INTERNAL_BUDGET
+#define LVGL_ALLOC_INTERNAL_BUDGET (32U * 1024U)
+#endif
+
+// Largest draw buffer placed in internal RAM; bigger layers go to PSRAM so WiFi/BLE keep headroom
+#ifndef LVGL_DRAW_BUF_INTERNAL_MAX
+#define LVGL_DRAW_BUF_INTERNAL_MAX (40U * 1024U)
+#endif
+
+namespace CloudMouse::Hardware
+{
+    enum class LvglPool
+    {
+        INTERNAL,
+        PSRAM
+    };
+
+    /**
+     * Usage counters of one pool
+     */
+    struct LvglPoolStats
+    {
+        uint32_t usedBytes = 0;     // Bytes currently held by LVGL
+        uint32_t peakBytes = 0;     // Highest usedBytes since boot
+        uint32_t blocks = 0;        // Live allocations
+        uint32_t allocations = 0;   // Successful allocations since boot
+        uint32_t failures = 0;      // Requests this pool could not satisfy
+    };
+
+    class LvglAllocator
+    {
+    public:
+        static const LvglPoolStats &getStats(LvglPool pool);
+
+        /**
+         * Fragmentation of the ESP-IDF heap region backing a pool
+         * (100 - largest free block / total free, in percent)
+         */
+        static uint8_t getFragmentation(LvglPool pool);
+
+        /**
+         * Print per-pool usage and heap state to Serial
+         */
+        static void print();
+
+        static const char *poolName(LvglPool pool);
+
+        /**
+         * Route LVGL draw buffers (default and font handlers) to internal RAM.
+         * Call once after lv_init(); decoded images keep the size-based placement.
+         */
+        static void installDrawBufHandlers();
+
+        // ========================================================================
+        // LVGL HOOKS (called from lv_malloc_core & co.)
+        // ========================================================================
+
+        static void *allocate(size_t size);
+        static void *reallocate(void *ptr, size_t size);
+        static void release(void *ptr);
+        static void monitor(lv_mem_monitor_t *mon);
+
+        static void *allocateDrawBuf(size_t size, lv_color_format_t format);
+        static void releaseDrawBuf(void *buf);
+
+    private:
+        static LvglPoolStats stats[2];
+
+        static LvglPool choosePool(size_t size);
+        static void *allocateFrom(LvglPool preferred, size_t size);
+        static LvglPool poolOf(void *ptr);
+        static uint32_t capsOf(LvglPool pool);
+        static void noteAllocated(void *ptr);
+        static void noteReleased(LvglPool pool, size_t bytes);
+    };
+
+} // namespace CloudMouse::Hardware
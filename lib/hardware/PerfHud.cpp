@@ -0,0 +1,227 @@
+/**
+ * CloudMouse SDK - On-Device Performance HUD Implementation
+ */
+
+#include "./PerfHud.h"
+#include "./UiTheme.h"
+#include "../core/EventBus.h"
+#include <esp_heap_caps.h>
+
+#ifndef CLOUDMOUSE_HOST_BUILD
+#include <WiFi.h>
+#include <esp_freertos_hooks.h>
+#include <esp_timer.h>
+#endif
+
+namespace CloudMouse::Hardware
+{
+    volatile uint32_t PerfHud::idleLastUs[PERF_HUD_MAX_CORES] = {};
+    volatile uint32_t PerfHud::idleUs[PERF_HUD_MAX_CORES] = {};
+
+    PerfHud::~PerfHud()
+    {
+        setIdleHooks(false);
+    }
+
+    // ============================================================================
+    // VISIBILITY
+    // ============================================================================
+
+    void PerfHud::setVisible(bool show)
+    {
+        if (show == visible) return;
+        if (show && !label && !create()) return;
+
+        visible = show;
+        if (visible)
+        {
+            resetCounters();
+            setIdleHooks(true);
+            lv_obj_remove_flag(label, LV_OBJ_FLAG_HIDDEN);
+            lv_timer_resume(timer);
+            refresh();
+        }
+        else
+        {
+            setIdleHooks(false);
+            lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+            lv_timer_pause(timer);
+        }
+
+        Serial.printf("📈 Performance HUD: %s\n", visible ? "on" : "off");
+    }
+
+    bool PerfHud::create()
+    {
+        // Top layer stays above every screen and survives screen changes
+        label = lv_label_create(lv_layer_top());
+        if (!label)
+        {
+            Serial.println("❌ Performance HUD: label creation failed");
+            return false;
+        }
+
+        UiTheme::apply(label, UiStyle::HUD);
+        lv_obj_set_size(label, 220, 84); // Fixed size: text updates never relayout
+        lv_obj_align(label, LV_ALIGN_TOP_RIGHT, -4, 44);
+        lv_obj_remove_flag(label, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_event_cb(label, labelDeleteCb, LV_EVENT_DELETE, this);
+
+        timer = lv_timer_create(timerCb, PERF_HUD_PERIOD_MS, this);
+        lv_timer_pause(timer);
+        return true;
+    }
+
+    // ============================================================================
+    // SAMPLING
+    // ============================================================================
+
+    void PerfHud::resetCounters()
+    {
+        frames = 0;
+        frameTimeUs = 0;
+        lastSampleUs = micros();
+        text[0] = '\0';
+
+        for (int core = 0; core < PERF_HUD_MAX_CORES; core++)
+        {
+            idleUs[core] = 0;
+            idleLastUs[core] = 0;
+        }
+    }
+
+    void PerfHud::refresh()
+    {
+        const uint32_t now = micros();
+        const uint32_t elapsedUs = now - lastSampleUs;
+        if (elapsedUs == 0) return;
+
+        const float fps = frames * 1000000.0f / elapsedUs;
+        const float frameMs = frames ? frameTimeUs / 1000.0f / frames : 0.0f;
+
+        char cpu[PERF_HUD_MAX_CORES][8];
+        for (int core = 0; core < PERF_HUD_MAX_CORES; core++)
+        {
+#ifndef CLOUDMOUSE_HOST_BUILD
+            const uint32_t idle = idleUs[core];
+            idleUs[core] = 0;
+            int load = 100 - (int)((uint64_t)idle * 100 / elapsedUs);
+            if (load < 0) load = 0;
+            snprintf(cpu[core], sizeof(cpu[core]), "%d%%", load);
+#else
+            snprintf(cpu[core], sizeof(cpu[core]), "--");
+#endif
+        }
+
+        char rssi[8] = "--";
+#ifndef CLOUDMOUSE_HOST_BUILD
+        if (WiFi.isConnected())
+        {
+            snprintf(rssi, sizeof(rssi), "%d", (int)WiFi.RSSI());
+        }
+#endif
+
+        char next[sizeof(text)];
+        snprintf(next, sizeof(next),
+                 "FPS %.1f  frame %.1f ms\n"
+                 "CPU0 %s  CPU1 %s\n"
+                 "RAM %uK  PSRAM %uK\n"
+                 "Queue %u/%u  RSSI %s",
+                 fps, frameMs, cpu[0], cpu[1],
+                 (unsigned)(heap_caps_get_free_size(MALLOC_CAP_INTERNAL) / 1024),
+                 (unsigned)(heap_caps_get_free_size(MALLOC_CAP_SPIRAM) / 1024),
+                 (unsigned)EventBus::instance().getUIQueueCount(),
+                 (unsigned)EventBus::instance().getMainQueueCount(), rssi);
+
+        // Same text: no invalidation at all
+        if (strcmp(next, text) != 0)
+        {
+            memcpy(text, next, sizeof(text));
+            lv_label_set_text_static(label, text);
+        }
+
+        frames = 0;
+        frameTimeUs = 0;
+        lastSampleUs = now;
+    }
+
+    // ============================================================================
+    // LVGL CALLBACKS
+    // ============================================================================
+
+    void PerfHud::timerCb(lv_timer_t *t)
+    {
+        PerfHud *self = (PerfHud *)lv_timer_get_user_data(t);
+        if (self->visible) self->refresh();
+    }
+
+    void PerfHud::labelDeleteCb(lv_event_t *e)
+    {
+        // Top layer cleared by someone else: start over on next show
+        PerfHud *self = (PerfHud *)lv_event_get_user_data(e);
+        if (self->timer) lv_timer_delete(self->timer);
+        self->timer = nullptr;
+        self->label = nullptr;
+        self->visible = false;
+        setIdleHooks(false);
+    }
+
+    // ============================================================================
+    // CPU LOAD
+    // ============================================================================
+
+    void PerfHud::setIdleHooks(bool enabled)
+    {
+#ifndef CLOUDMOUSE_HOST_BUILD
+        static bool registered = false;
+        if (enabled == registered) return;
+
+        if (enabled)
+        {
+            esp_register_freertos_idle_hook_for_cpu(idleHookCore0, 0);
+#if portNUM_PROCESSORS > 1
+            esp_register_freertos_idle_hook_for_cpu(idleHookCore1, 1);
+#endif
+        }
+        else
+        {
+            esp_deregister_freertos_idle_hook_for_cpu(idleHookCore0, 0);
+#if portNUM_PROCESSORS > 1
+            esp_deregister_freertos_idle_hook_for_cpu(idleHookCore1, 1);
+#endif
+        }
+        registered = enabled;
+#else
+        (void)enabled;
+#endif
+    }
+
+    void PerfHud::noteIdle(int core)
+    {
+#ifndef CLOUDMOUSE_HOST_BUILD
+        const uint32_t now = (uint32_t)esp_timer_get_time();
+        const uint32_t gap = now - idleLastUs[core];
+        if (idleLastUs[core] && gap < PERF_HUD_IDLE_GAP_US)
+        {
+            idleUs[core] += gap;
+        }
+        idleLastUs[core] = now;
+#else
+        (void)core;
+#endif
+    }
+
+    bool PerfHud::idleHookCore0()
+    {
+        noteIdle(0);
+        return false; // Keep spinning so consecutive calls measure idle time
+    }
+
+    bool PerfHud::idleHookCore1()
+    {
+        noteIdle(1);
+        return false;
+    }
+
+} // namespace CloudMouse::Hardware
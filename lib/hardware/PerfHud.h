@@ -0,0 +1,102 @@
+/**
+ * CloudMouse SDK - On-Device Performance HUD
+ *
+ * Small overlay on LVGL's top layer for judging performance in the field without a
+ * serial console. Toggled with an ultra-long press or the "display hud" command.
+ *
+ * Shows (refreshed every PERF_HUD_PERIOD_MS):
+ * - Rendered frames per second and average render + transfer time per frame
+ * - CPU load per core
+ * - Free internal and PSRAM heap
+ * - EventBus queue depth (UI / main) and WiFi RSSI
+ *
+ * CPU Load:
+ * - Run-time stats are disabled in this sdkconfig, so idle time is measured with
+ *   FreeRTOS idle hooks: consecutive hook calls less than PERF_HUD_IDLE_GAP_US apart
+ *   count as idle time. The hooks keep the idle task spinning, so they are only
+ *   registered while the HUD is visible.
+ *
+ * Invalidation:
+ * - One fixed-size label; its text is only replaced when a value changed, so the HUD
+ *   redraws at most its own rectangle twice per second
+ *
+ * Host Builds:
+ * - No idle hooks or WiFi; CPU and RSSI show "--"
+ *
+ * Thread Safety:
+ * - UI task only, except the idle hooks which only touch their own core's counters
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+#ifndef PERF_HUD_PERIOD_MS
+#define PERF_HUD_PERIOD_MS 500
+#endif
+
+// Longer gaps between idle hook calls mean another task ran in between
+#ifndef PERF_HUD_IDLE_GAP_US
+#define PERF_HUD_IDLE_GAP_US 100
+#endif
+
+#define PERF_HUD_MAX_CORES 2
+
+namespace CloudMouse::Hardware
+{
+    class PerfHud
+    {
+    public:
+        ~PerfHud();
+
+        /**
+         * Show or hide the overlay (created on first show)
+         */
+        void setVisible(bool visible);
+        bool isVisible() const { return visible; }
+        void toggle() { setVisible(!visible); }
+
+        /**
+         * Account one rendered frame (called by DisplayManager at end of frame)
+         *
+         * @param frameUs Render + transfer time of the frame
+         */
+        void noteFrame(uint32_t frameUs)
+        {
+            frames++;
+            frameTimeUs += frameUs;
+        }
+
+    private:
+        lv_obj_t *label = nullptr;
+        lv_timer_t *timer = nullptr;
+        bool visible = false;
+
+        uint32_t frames = 0;
+        uint64_t frameTimeUs = 0;
+        uint32_t lastSampleUs = 0;
+        char text[160] = {};
+
+        bool create();
+        void refresh();
+        void resetCounters();
+
+        static void timerCb(lv_timer_t *timer);
+        static void labelDeleteCb(lv_event_t *e);
+
+        // ========================================================================
+        // CPU LOAD (FreeRTOS idle hooks)
+        // ========================================================================
+
+        // 32-bit so hook and UI task never see torn values
+        static volatile uint32_t idleLastUs[PERF_HUD_MAX_CORES];
+        static volatile uint32_t idleUs[PERF_HUD_MAX_CORES];
+
+        static void setIdleHooks(bool enabled);
+        static void noteIdle(int core);
+        static bool idleHookCore0();
+        static bool idleHookCore1();
+    };
+
+} // namespace CloudMouse::Hardware
@@ -0,0 +1,110 @@
+/**
+ * CloudMouse SDK - RGB565 to RGB666 Pixel Conversion Implementation
+ *
+ * Kernel layout (little-endian, two pixels per 32-bit lane word):
+ *   w = p1 << 16 | p0
+ *   R/G/B are extracted for both pixels at once, widened in place (no carry crosses
+ *   the 16-bit lane boundary because every widened channel is < 256) and packed into
+ *   three 32-bit output words per 4 pixels:
+ *     out0 = R0 | G0 << 8 | B0 << 16 | R1 << 24
+ *     out1 = G1 | B1 << 8 | R2 << 16 | G2 << 24
+ *     out2 = B2 | R3 << 8 | G3 << 16 | B3 << 24
+ */
+
+#include "./PixelConverter.h"
+
+namespace CloudMouse::Hardware
+{
+    namespace
+    {
+        inline uint16_t swap16(uint16_t v)
+        {
+            return (uint16_t)((v << 8) | (v >> 8));
+        }
+
+        inline void convertPixel(uint8_t *dst, uint16_t px)
+        {
+            uint8_t r = (px >> 11) & 0x1F;
+            uint8_t g = (px >> 5) & 0x3F;
+            uint8_t b = px & 0x1F;
+
+            dst[0] = (r << 3) | (r >> 2);
+            dst[1] = (g << 2) | (g >> 4);
+            dst[2] = (b << 3) | (b >> 2);
+        }
+
+        template <bool Swapped>
+        inline uint32_t loadPair(const uint16_t *src)
+        {
+            // Two aligned 16-bit loads: source bands may start on any pixel
+            uint32_t w = (uint32_t)src[0] | ((uint32_t)src[1] << 16);
+            if (Swapped)
+            {
+                w = ((w & 0x00FF00FFu) << 8) | ((w >> 8) & 0x00FF00FFu);
+            }
+            return w;
+        }
+
+        template <bool Swapped>
+        void convertKernel(uint8_t *dst, const uint16_t *src, size_t count)
+        {
+            uint32_t *out = (uint32_t *)dst;
+            size_t blocks = count / 4;
+
+            for (size_t i = 0; i < blocks; i++)
+            {
+                uint32_t wa = loadPair<Swapped>(src);
+                uint32_t wb = loadPair<Swapped>(src + 2);
+                src += 4;
+
+                uint32_t ra = (wa >> 11) & 0x001F001Fu;
+                uint32_t ga = (wa >> 5) & 0x003F003Fu;
+                uint32_t ba = wa & 0x001F001Fu;
+                uint32_t rb = (wb >> 11) & 0x001F001Fu;
+                uint32_t gb = (wb >> 5) & 0x003F003Fu;
+                uint32_t bb = wb & 0x001F001Fu;
+
+                ra = (ra << 3) | (ra >> 2);
+                ga = (ga << 2) | (ga >> 4);
+                ba = (ba << 3) | (ba >> 2);
+                rb = (rb << 3) | (rb >> 2);
+                gb = (gb << 2) | (gb >> 4);
+                bb = (bb << 3) | (bb >> 2);
+
+                out[0] = (ra & 0xFF) | ((ga & 0xFF) << 8) | ((ba & 0xFF) << 16) | ((ra & 0xFF0000u) << 8);
+                out[1] = (ga >> 16) | ((ba >> 16) << 8) | ((rb & 0xFF) << 16) | ((gb & 0xFF) << 24);
+                out[2] = (bb & 0xFF) | ((rb >> 16) << 8) | ((gb >> 16) << 16) | ((bb >> 16) << 24);
+                out += 3;
+            }
+
+            // Remaining 0-3 pixels
+            dst = (uint8_t *)out;
+            for (size_t i = 0; i < count % 4; i++)
+            {
+                convertPixel(dst, Swapped ? swap16(src[i]) : src[i]);
+                dst += 3;
+            }
+        }
+    }
+
+    void PixelConverter::rgb565ToRgb666Reference(uint8_t *dst, const uint16_t *src, size_t count, bool swapped)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            convertPixel(dst + i * 3, swapped ? swap16(src[i]) : src[i]);
+        }
+    }
+
+    void PixelConverter::rgb565ToRgb666(uint8_t *dst, const uint16_t *src, size_t count, bool swapped)
+    {
+        if (swapped)
+        {
+            convertKernel<true>(dst, src, count);
+        }
+        else
+        {
+            convertKernel<false>(dst, src, count);
+        }
+    }
+
+} // namespace CloudMouse::Hardware
@@ -0,0 +1,59 @@
+/**
+ * CloudMouse SDK - RGB565 to RGB666 Pixel Conversion
+ *
+ * The ILI9488 in 4-wire SPI mode only accepts 18-bit pixels, transmitted as three bytes
+ * (R, G, B, upper 6 bits significant). LVGL renders RGB565, so every flushed pixel is
+ * expanded from 2 to 3 bytes on the critical path of each frame.
+ *
+ * This module provides:
+ * - A portable per-pixel reference conversion (bit-exact specification)
+ * - A word-parallel kernel converting 4 pixels per iteration with 32-bit stores,
+ *   optionally fused with a per-pixel byte swap for byte-swapped RGB565 sources
+ *
+ * Output Format:
+ * - 3 bytes per pixel in wire order R, G, B
+ * - Each channel widened to 8 bits by bit replication (same as LovyanGFX conversion),
+ *   so the panel receives exactly the bytes the generic pushImage() path would send
+ *
+ * Alignment:
+ * - Source needs 2-byte alignment, destination 4-byte alignment for the fast path
+ *   (staging buffers allocated by DisplayManager satisfy both)
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+namespace CloudMouse::Hardware
+{
+    class PixelConverter
+    {
+    public:
+        /**
+         * Reference conversion, one pixel at a time
+         *
+         * @param dst Destination, 3 * count bytes
+         * @param src Source RGB565 pixels
+         * @param count Number of pixels
+         * @param swapped true if source pixels are byte-swapped (big-endian RGB565)
+         */
+        static void rgb565ToRgb666Reference(uint8_t *dst, const uint16_t *src, size_t count, bool swapped);
+
+        /**
+         * Fast conversion kernel (4 pixels per iteration, scalar tail)
+         * Bit-exact with rgb565ToRgb666Reference()
+         *
+         * @param dst Destination, 3 * count bytes, 4-byte aligned
+         * @param src Source RGB565 pixels, 2-byte aligned
+         * @param count Number of pixels
+         * @param swapped true if source pixels are byte-swapped (big-endian RGB565)
+         */
+        static void rgb565ToRgb666(uint8_t *dst, const uint16_t *src, size_t count, bool swapped);
+
+        /**
+         * Bytes required to hold count converted pixels
+         */
+        static constexpr size_t outputSize(size_t count) { return count * 3; }
+    };
+
+} // namespace CloudMouse::Hardware
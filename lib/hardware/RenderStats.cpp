@@ -0,0 +1,194 @@
+/**
+ * CloudMouse SDK - LVGL Render Analytics Implementation
+ */
+
+#include "./RenderStats.h"
+
+namespace CloudMouse::Hardware
+{
+    // ============================================================================
+    // RENDER PATH HOOKS
+    // ============================================================================
+
+    void RenderStats::noteInvalidation(const lv_area_t *area)
+    {
+        if (!area) return;
+
+        pendingInvalidations++;
+        pendingInvalidatedPixels += lv_area_get_size(area);
+
+        if (pendingAreaCount < RENDER_STATS_MAX_OVERLAY_AREAS)
+        {
+            pendingAreas[pendingAreaCount++] = *area;
+        }
+    }
+
+    void RenderStats::beginFrame(uint32_t transferUsTotal)
+    {
+        frameOpen = true;
+        frameStartUs = micros();
+        frameTransferStartUs = transferUsTotal;
+
+        // Invalidations requested so far belong to this frame
+        frameInvalidations = pendingInvalidations;
+        frameInvalidatedPixels = pendingInvalidatedPixels;
+        frameAreaCount = pendingAreaCount;
+        memcpy(frameAreas, pendingAreas, sizeof(lv_area_t) * pendingAreaCount);
+
+        pendingInvalidations = 0;
+        pendingInvalidatedPixels = 0;
+        pendingAreaCount = 0;
+
+        frameFlushes = 0;
+        framePushedPixels = 0;
+    }
+
+    void RenderStats::noteFlush(const lv_area_t *area)
+    {
+        frameFlushes++;
+        framePushedPixels += lv_area_get_size(area);
+    }
+
+    void RenderStats::endFrame(uint8_t screen, uint32_t transferUsTotal)
+    {
+        if (!frameOpen) return;
+        frameOpen = false;
+
+        // Refresh cycles without any flush are not frames
+        if (frameFlushes == 0) return;
+
+        uint32_t totalUs = micros() - frameStartUs;
+        uint32_t transferUs = transferUsTotal - frameTransferStartUs;
+        if (transferUs > totalUs) transferUs = totalUs;
+
+        if (screen >= RENDER_STATS_MAX_SCREENS) screen = RENDER_STATS_MAX_SCREENS - 1;
+        RenderScreenStats &s = screens[screen];
+
+        s.frames++;
+        s.flushes += frameFlushes;
+        s.invalidations += frameInvalidations;
+        s.invalidatedPixels += frameInvalidatedPixels;
+        s.pushedPixels += framePushedPixels;
+        s.renderUs += totalUs - transferUs;
+        s.transferUs += transferUs;
+        if (totalUs > s.maxFrameUs) s.maxFrameUs = totalUs;
+
+        lastFrame.index++;
+        lastFrame.screen = screen;
+        lastFrame.totalUs = totalUs;
+        lastFrame.transferUs = transferUs;
+        lastFrame.invalidatedPixels = frameInvalidatedPixels;
+        lastFrame.pushedPixels = framePushedPixels;
+        lastFrame.flushes = frameFlushes;
+    }
+
+    // ============================================================================
+    // REDRAW OVERLAY
+    // ============================================================================
+
+    void RenderStats::drawOverlay(const lv_area_t *band, uint8_t *px_map, bool indexed) const
+    {
+        if (!overlay) return;
+
+        if (indexed)
+        {
+            outline<uint8_t>(band, px_map, 0xFF); // Brightest L8 value
+        }
+        else
+        {
+            outline<uint16_t>(band, (uint16_t *)px_map, 0xF81F); // Magenta, rarely used by the UI theme
+        }
+    }
+
+    template <typename Pixel>
+    void RenderStats::outline(const lv_area_t *band, Pixel *px, Pixel color) const
+    {
+        const int32_t stride = lv_area_get_width(band);
+
+        for (uint8_t i = 0; i < frameAreaCount; i++)
+        {
+            const lv_area_t &a = frameAreas[i];
+            lv_area_t clip;
+            if (!lv_area_intersect(&clip, &a, band)) continue;
+
+            // Horizontal edges
+            for (int32_t y : {a.y1, a.y2})
+            {
+                if (y < clip.y1 || y > clip.y2) continue;
+                Pixel *row = px + (y - band->y1) * stride;
+                for (int32_t x = clip.x1; x <= clip.x2; x++)
+                {
+                    row[x - band->x1] = color;
+                }
+            }
+
+            // Vertical edges
+            for (int32_t x : {a.x1, a.x2})
+            {
+                if (x < clip.x1 || x > clip.x2) continue;
+                for (int32_t y = clip.y1; y <= clip.y2; y++)
+                {
+                    px[(y - band->y1) * stride + (x - band->x1)] = color;
+                }
+            }
+        }
+    }
+
+    // ============================================================================
+    // REPORTING
+    // ============================================================================
+
+    void RenderStats::print(const char *const *screenNames, uint8_t screenCount, uint32_t panelPixels) const
+    {
+        Serial.println("\n📐 RENDER_STATS_START");
+        Serial.println("  screen            frames  inval/f  inval_px/f  (% panel)  flush/f  pushed_px/f  spi_KB/f  render_us/f  xfer_us/f  max_us");
+
+        for (uint8_t i = 0; i < RENDER_STATS_MAX_SCREENS; i++)
+        {
+            const RenderScreenStats &s = screens[i];
+            if (s.frames == 0) continue;
+
+            const char *name = (i < screenCount && screenNames[i]) ? screenNames[i] : nullptr;
+            uint32_t invalPx = s.invalidatedPixels / s.frames;
+            uint32_t pushedPx = s.pushedPixels / s.frames;
+
+            if (name)
+            {
+                Serial.printf("  %-17s ", name);
+            }
+            else
+            {
+                Serial.printf("  #%-16u ", i);
+            }
+
+            Serial.printf("%-7lu %-8.1f %-11lu %-10.1f %-8.1f %-12lu %-9.1f %-12lu %-10lu %lu\n",
+                          (unsigned long)s.frames,
+                          (float)s.invalidations / s.frames,
+                          (unsigned long)invalPx,
+                          panelPixels ? 100.0f * invalPx / panelPixels : 0.0f,
+                          (float)s.flushes / s.frames,
+                          (unsigned long)pushedPx,
+                          pushedPx * RENDER_STATS_SPI_BYTES_PER_PIXEL / 1024.0f,
+                          (unsigned long)(s.renderUs / s.frames),
+                          (unsigned long)(s.transferUs / s.frames),
+                          (unsigned long)s.maxFrameUs);
+        }
+
+        Serial.println("📐 RENDER_STATS_END\n");
+    }
+
+    void RenderStats::reset()
+    {
+        for (auto &s : screens)
+        {
+            s = RenderScreenStats();
+        }
+    }
+
+    const RenderScreenStats &RenderStats::getScreenStats(uint8_t screen) const
+    {
+        if (screen >= RENDER_STATS_MAX_SCREENS) screen = RENDER_STATS_MAX_SCREENS - 1;
+        return screens[screen];
+    }
+
+} // namespace CloudMouse::Hardware
@@ -0,0 +1,141 @@
+/**
+ * CloudMouse SDK - LVGL Render Analytics
+ *
+ * Per-frame and per-screen accounting of how much of the panel LVGL redraws and how
+ * many bytes the flush path pushes over SPI. Fed by DisplayManager from LVGL display
+ * events (invalidate, refresh start) and from the flush callback.
+ *
+ * Metrics:
+ * - Invalidated area: sum of clipped invalidation rectangles requested before a frame
+ * - Flushes, pixels and SPI bytes actually pushed to the panel
+ * - Render time (CPU) vs. transfer time (blocking SPI / DMA wait) per frame
+ * - Aggregated per screen so widgets that over-invalidate are easy to spot
+ *
+ * Overlay:
+ * - Keeps the invalidated rectangles of the frame being rendered so the flush callback
+ *   can outline them directly in the outgoing band (debug aid, costs a few µs per band)
+ *
+ * Thread Safety:
+ * - UI task only (same task that runs lv_timer_handler)
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// ILI9488 over SPI receives RGB666 packed in 3 bytes per pixel
+#define RENDER_STATS_SPI_BYTES_PER_PIXEL 3
+
+// Maximum number of screens tracked individually (extra screens share the last slot)
+#define RENDER_STATS_MAX_SCREENS 8
+
+// Maximum invalidated rectangles remembered per frame for the overlay
+#define RENDER_STATS_MAX_OVERLAY_AREAS 16
+
+namespace CloudMouse::Hardware
+{
+    /**
+     * Aggregated counters for one screen
+     */
+    struct RenderScreenStats
+    {
+        uint32_t frames = 0;           // Frames that flushed at least one band
+        uint32_t flushes = 0;          // Flush callback invocations
+        uint32_t invalidations = 0;    // Invalidation requests
+        uint64_t invalidatedPixels = 0;
+        uint64_t pushedPixels = 0;
+        uint64_t renderUs = 0;         // CPU time spent rendering
+        uint64_t transferUs = 0;       // Time spent waiting for SPI
+        uint32_t maxFrameUs = 0;
+    };
+
+    /**
+     * Metrics of the most recently completed frame
+     */
+    struct RenderFrameSample
+    {
+        uint32_t index = 0;            // Monotonic frame number (0 = no frame yet)
+        uint8_t screen = 0;
+        uint32_t totalUs = 0;
+        uint32_t transferUs = 0;
+        uint32_t invalidatedPixels = 0;
+        uint32_t pushedPixels = 0;
+        uint32_t flushes = 0;
+    };
+
+    class RenderStats
+    {
+    public:
+        // ========================================================================
+        // RENDER PATH HOOKS (called by DisplayManager)
+        // ========================================================================
+
+        void noteInvalidation(const lv_area_t *area);
+        void beginFrame(uint32_t transferUsTotal);
+        void noteFlush(const lv_area_t *area);
+        void endFrame(uint8_t screen, uint32_t transferUsTotal);
+        bool isFrameOpen() const { return frameOpen; }
+
+        // ========================================================================
+        // REDRAW OVERLAY
+        // ========================================================================
+
+        void setOverlay(bool enabled) { overlay = enabled; }
+        bool isOverlayEnabled() const { return overlay; }
+
+        /**
+         * Outline this frame's invalidated rectangles inside an outgoing band
+         *
+         * @param band Screen area covered by px_map
+         * @param px_map Band pixels (stride = band width)
+         * @param indexed true for L8 bands (outlined in white), false for RGB565 (magenta)
+         */
+        void drawOverlay(const lv_area_t *band, uint8_t *px_map, bool indexed) const;
+
+        // ========================================================================
+        // REPORTING
+        // ========================================================================
+
+        /**
+         * Print per-screen aggregates to Serial
+         *
+         * @param screenNames Names indexed by screen id (nullptr entries print as numbers)
+         * @param screenCount Number of entries in screenNames
+         * @param panelPixels Panel size in pixels, for percentage figures
+         */
+        void print(const char *const *screenNames, uint8_t screenCount, uint32_t panelPixels) const;
+        void reset();
+
+        const RenderScreenStats &getScreenStats(uint8_t screen) const;
+        const RenderFrameSample &getLastFrame() const { return lastFrame; }
+
+    private:
+        RenderScreenStats screens[RENDER_STATS_MAX_SCREENS];
+
+        // Invalidations accumulated since the previous frame started
+        uint32_t pendingInvalidations = 0;
+        uint32_t pendingInvalidatedPixels = 0;
+        lv_area_t pendingAreas[RENDER_STATS_MAX_OVERLAY_AREAS];
+        uint8_t pendingAreaCount = 0;
+
+        // Frame in progress
+        bool frameOpen = false;
+        uint32_t frameStartUs = 0;
+        uint32_t frameTransferStartUs = 0;
+        uint32_t frameInvalidations = 0;
+        uint32_t frameInvalidatedPixels = 0;
+        uint32_t frameFlushes = 0;
+        uint32_t framePushedPixels = 0;
+        lv_area_t frameAreas[RENDER_STATS_MAX_OVERLAY_AREAS];
+        uint8_t frameAreaCount = 0;
+
+        RenderFrameSample lastFrame;
+
+        bool overlay = false;
+
+        template <typename Pixel>
+        void outline(const lv_area_t *band, Pixel *px, Pixel color) const;
+    };
+
+} // namespace CloudMouse::Hardware
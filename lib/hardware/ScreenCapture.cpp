@@ -0,0 +1,412 @@
+/**
+ * CloudMouse SDK - Display Screenshot and Stream Capture Implementation
+ */
+
+#include "./ScreenCapture.h"
+#include "./DisplayManager.h"
+
+namespace CloudMouse::Hardware
+{
+    namespace
+    {
+        const uint8_t FRAME_KEYFRAME = 0x01;
+        const uint8_t FRAME_SWAPPED = 0x02;
+        const size_t PACKET_HEADER_BYTES = 9; // Magic, flags, seq, len
+
+        // Run of at least this many equal pixels is cheaper as a repeat run
+        const uint32_t RLE_MIN_REPEAT = 3;
+        const uint32_t RLE_MAX_RUN = 0x7FFF;
+
+        uint16_t fletcher16(const uint8_t *data, size_t bytes)
+        {
+            uint16_t sum1 = 0;
+            uint16_t sum2 = 0;
+            for (size_t i = 0; i < bytes; i++)
+            {
+                sum1 = (sum1 + data[i]) % 255;
+                sum2 = (sum2 + sum1) % 255;
+            }
+            return (sum2 << 8) | sum1;
+        }
+
+        const char *sinkName(CaptureSink sink)
+        {
+            switch (sink)
+            {
+            case CaptureSink::HTTP:
+                return "http";
+            case CaptureSink::WEBSOCKET:
+                return "websocket";
+            default:
+                return "serial";
+            }
+        }
+    }
+
+    ScreenCapture::~ScreenCapture()
+    {
+        if (ring)
+        {
+            free(ring);
+            ring = nullptr;
+        }
+    }
+
+    // ============================================================================
+    // CONTROL
+    // ============================================================================
+
+    bool ScreenCapture::requestScreenshot(CaptureSink target)
+    {
+        if (!allocateRing()) return false;
+
+        sink.store(target, std::memory_order_relaxed);
+        mode = CaptureMode::SCREENSHOT;
+        if (!frameOpen) armed = false; // Re-arm as a keyframe
+        Serial.printf("📸 Screenshot requested (%s)\n", sinkName(target));
+        return true;
+    }
+
+    bool ScreenCapture::startStream(uint8_t fps, CaptureSink target)
+    {
+        if (fps == 0 || !allocateRing()) return false;
+
+        sink.store(target, std::memory_order_relaxed);
+        mode = CaptureMode::STREAM;
+        if (!frameOpen) armed = false;
+        intervalMs = 1000 / fps;
+        nextDueMs = millis();
+        needKeyframe = true;
+        hasSkipped = false;
+        Serial.printf("📸 Capture stream: up to %u fps (%s)\n", fps, sinkName(target));
+        return true;
+    }
+
+    void ScreenCapture::stop()
+    {
+        if (mode == CaptureMode::OFF) return;
+
+        // A frame in progress still ends cleanly in endFrame()
+        mode = CaptureMode::OFF;
+        if (!frameOpen) armed = false;
+        hasSkipped = false;
+        Serial.println("📸 Capture stopped");
+    }
+
+    bool ScreenCapture::allocateRing()
+    {
+        if (ring) return true;
+
+        ring = (uint8_t *)ps_malloc(CAPTURE_RING_BYTES);
+        if (!ring)
+        {
+            Serial.printf("❌ Capture: %d byte PSRAM ring unavailable\n", CAPTURE_RING_BYTES);
+            return false;
+        }
+        head.store(0);
+        tail.store(0);
+        return true;
+    }
+
+    void ScreenCapture::print() const
+    {
+        const uint32_t h = head.load(std::memory_order_acquire);
+        const uint32_t t = tail.load(std::memory_order_relaxed);
+        const uint32_t queued = (h + CAPTURE_RING_BYTES - t) % CAPTURE_RING_BYTES;
+
+        Serial.printf("📸 Capture: mode=%s, %lu frames, %lu dropped, ring %lu/%d bytes queued\n",
+                      mode == CaptureMode::STREAM ? "stream" : mode == CaptureMode::SCREENSHOT ? "screenshot" : "off",
+                      (unsigned long)framesCaptured, (unsigned long)framesDropped,
+                      (unsigned long)(ring ? queued : 0), CAPTURE_RING_BYTES);
+
+        if (pixelsCaptured > 0)
+        {
+            Serial.printf("   %llu px -> %llu bytes (%.1f%% of RGB565), encode %.2f us/kpx\n",
+                          (unsigned long long)pixelsCaptured, (unsigned long long)bytesEncoded,
+                          bytesEncoded * 100.0f / (pixelsCaptured * 2.0f),
+                          encodeUs * 1000.0f / pixelsCaptured);
+        }
+    }
+
+    // ============================================================================
+    // RENDER PATH HOOKS
+    // ============================================================================
+
+    void ScreenCapture::prepareFrame(lv_display_t *disp)
+    {
+        if (mode == CaptureMode::OFF || armed) return;
+        if (mode == CaptureMode::STREAM && (int32_t)(millis() - nextDueMs) < 0) return;
+
+        width = (uint16_t)lv_display_get_horizontal_resolution(disp);
+        height = (uint16_t)lv_display_get_vertical_resolution(disp);
+        armed = true;
+        keyframe = needKeyframe || mode == CaptureMode::SCREENSHOT;
+
+        // Redraw whatever the decoder has not received yet (screen + top layer)
+        if (keyframe)
+        {
+            lv_area_t full = {0, 0, (int32_t)width - 1, (int32_t)height - 1};
+            lv_inv_area(disp, &full);
+        }
+        else if (hasSkipped)
+        {
+            lv_inv_area(disp, &skipped);
+        }
+        hasSkipped = false;
+    }
+
+    void ScreenCapture::captureBand(const lv_area_t *area, const uint8_t *px_map)
+    {
+        if (mode == CaptureMode::OFF && !frameOpen) return;
+
+        if (!armed)
+        {
+            if (mode != CaptureMode::STREAM) return;
+
+            // Not captured this time: remember it for the next captured frame
+            if (hasSkipped)
+            {
+                lv_area_t merged;
+                merged.x1 = LV_MIN(skipped.x1, area->x1);
+                merged.y1 = LV_MIN(skipped.y1, area->y1);
+                merged.x2 = LV_MAX(skipped.x2, area->x2);
+                merged.y2 = LV_MAX(skipped.y2, area->y2);
+                skipped = merged;
+            }
+            else
+            {
+                skipped = *area;
+                hasSkipped = true;
+            }
+            return;
+        }
+
+        if (!frameOpen) openFrame();
+        if (dropping) return;
+
+        const uint32_t start = micros();
+        const uint16_t w = (uint16_t)lv_area_get_width(area);
+        const uint16_t h = (uint16_t)lv_area_get_height(area);
+
+        put8('B');
+        put16((uint16_t)area->x1);
+        put16((uint16_t)area->y1);
+        put16(w);
+        put16(h);
+        if (indexedLut) encodeRle(px_map, (uint32_t)w * h);
+        else encodeRle((const uint16_t *)px_map, (uint32_t)w * h);
+
+        pixelsCaptured += (uint32_t)w * h;
+        encodeUs += micros() - start;
+    }
+
+    void ScreenCapture::endFrame()
+    {
+        if (!armed || !frameOpen) return; // Armed frames without flushes stay armed
+
+        put8('E');
+        commitPacket(true);
+        frameOpen = false;
+        armed = false;
+
+        const bool dropped = dropping;
+        dropping = false;
+        if (dropped)
+        {
+            // Decoder canvas is now stale: the next capture must be complete
+            framesDropped++;
+            needKeyframe = true;
+        }
+        else
+        {
+            framesCaptured++;
+            needKeyframe = false;
+        }
+
+        // A stream frame that was open when the screenshot was requested does not count
+        if (mode == CaptureMode::SCREENSHOT && keyframe)
+        {
+            mode = CaptureMode::OFF;
+            if (dropped)
+            {
+                Serial.println("❌ Screenshot dropped: capture ring full (drain it or raise CAPTURE_RING_BYTES)");
+            }
+            else
+            {
+                Serial.printf("📸 Screenshot captured: %ux%u, sequence %u\n", width, height, sequence);
+            }
+        }
+        else if (mode == CaptureMode::STREAM)
+        {
+            nextDueMs = millis() + intervalMs;
+        }
+    }
+
+    // ============================================================================
+    // ENCODING
+    // ============================================================================
+
+    void ScreenCapture::openFrame()
+    {
+        frameOpen = true;
+        dropping = false;
+        packetLen = 0;
+        packetFlags = PACKET_FRAME_START;
+
+        put8('F');
+        put32(framesCaptured + framesDropped + 1);
+        put32(millis());
+        put16(width);
+        put16(height);
+        put8((keyframe ? FRAME_KEYFRAME : 0) | (DISPLAY_RGB565_SWAPPED && !indexedLut ? FRAME_SWAPPED : 0));
+    }
+
+    void ScreenCapture::put(const void *data, size_t bytes)
+    {
+        const uint8_t *src = (const uint8_t *)data;
+        bytesEncoded += bytes;
+
+        while (bytes > 0 && !dropping)
+        {
+            size_t room = CAPTURE_PACKET_PAYLOAD - packetLen;
+            size_t chunk = bytes < room ? bytes : room;
+            memcpy(packet + PACKET_HEADER_BYTES + packetLen, src, chunk);
+            packetLen += chunk;
+            src += chunk;
+            bytes -= chunk;
+
+            if (packetLen == CAPTURE_PACKET_PAYLOAD) commitPacket(false);
+        }
+    }
+
+    void ScreenCapture::put16(uint16_t value)
+    {
+        uint8_t bytes[2] = {(uint8_t)value, (uint8_t)(value >> 8)};
+        put(bytes, 2);
+    }
+
+    void ScreenCapture::put32(uint32_t value)
+    {
+        uint8_t bytes[4] = {(uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+        put(bytes, 4);
+    }
+
+    template <typename Pixel>
+    void ScreenCapture::encodeRle(const Pixel *pixels, uint32_t count)
+    {
+        uint32_t i = 0;
+        while (i < count && !dropping)
+        {
+            uint32_t run = 1;
+            while (i + run < count && run < RLE_MAX_RUN && pixels[i + run] == pixels[i]) run++;
+
+            if (run >= RLE_MIN_REPEAT)
+            {
+                put16(0x8000 | run);
+                putPixels(&pixels[i], 1);
+                i += run;
+                continue;
+            }
+
+            // Literal pixels up to the next repeat run
+            const uint32_t start = i;
+            while (i < count && i - start < RLE_MAX_RUN)
+            {
+                if (i + 2 < count && pixels[i] == pixels[i + 1] && pixels[i] == pixels[i + 2]) break;
+                i++;
+            }
+            put16(i - start);
+            putPixels(&pixels[start], i - start);
+        }
+    }
+
+    void ScreenCapture::putPixels(const uint8_t *values, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++) put16(indexedLut[values[i]]);
+    }
+
+    // ============================================================================
+    // PACKET RING
+    // ============================================================================
+
+    void ScreenCapture::commitPacket(bool frameEnd)
+    {
+        if (dropping || (packetLen == 0 && !frameEnd))
+        {
+            packetLen = 0;
+            return;
+        }
+
+        packet[0] = 'C';
+        packet[1] = 'M';
+        packet[2] = 'C';
+        packet[3] = 'P';
+        packet[4] = packetFlags | (frameEnd ? PACKET_FRAME_END : 0);
+        packet[5] = (uint8_t)sequence;
+        packet[6] = (uint8_t)(sequence >> 8);
+        packet[7] = (uint8_t)packetLen;
+        packet[8] = (uint8_t)(packetLen >> 8);
+
+        const size_t body = PACKET_HEADER_BYTES + packetLen;
+        const uint16_t sum = fletcher16(packet + 4, body - 4);
+        packet[body] = (uint8_t)sum;
+        packet[body + 1] = (uint8_t)(sum >> 8);
+        const uint16_t size = (uint16_t)(body + 2);
+
+        // One byte always stays free so head == tail means empty
+        const uint32_t h = head.load(std::memory_order_relaxed);
+        const uint32_t t = tail.load(std::memory_order_acquire);
+        const uint32_t used = (h + CAPTURE_RING_BYTES - t) % CAPTURE_RING_BYTES;
+        if (CAPTURE_RING_BYTES - 1 - used < (uint32_t)size + 2)
+        {
+            dropping = true;
+            packetLen = 0;
+            return;
+        }
+
+        uint8_t prefix[2] = {(uint8_t)size, (uint8_t)(size >> 8)};
+        ringWrite(h, prefix, 2);
+        ringWrite((h + 2) % CAPTURE_RING_BYTES, packet, size);
+        head.store((h + 2 + size) % CAPTURE_RING_BYTES, std::memory_order_release);
+
+        sequence++;
+        packetLen = 0;
+        packetFlags = 0;
+    }
+
+    size_t ScreenCapture::readPacket(uint8_t *dst, size_t max)
+    {
+        const uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return 0;
+
+        uint8_t prefix[2];
+        ringRead(t, prefix, 2);
+        const uint16_t size = prefix[0] | (prefix[1] << 8);
+        const uint32_t next = (t + 2 + size) % CAPTURE_RING_BYTES;
+
+        if (size > max)
+        {
+            tail.store(next, std::memory_order_release); // Caller buffer too small: skip
+            return 0;
+        }
+
+        ringRead((t + 2) % CAPTURE_RING_BYTES, dst, size);
+        tail.store(next, std::memory_order_release);
+        return size;
+    }
+
+    void ScreenCapture::ringWrite(uint32_t pos, const uint8_t *data, size_t bytes)
+    {
+        const size_t first = bytes < CAPTURE_RING_BYTES - pos ? bytes : CAPTURE_RING_BYTES - pos;
+        memcpy(ring + pos, data, first);
+        if (first < bytes) memcpy(ring, data + first, bytes - first);
+    }
+
+    void ScreenCapture::ringRead(uint32_t pos, uint8_t *data, size_t bytes) const
+    {
+        const size_t first = bytes < CAPTURE_RING_BYTES - pos ? bytes : CAPTURE_RING_BYTES - pos;
+        memcpy(data, ring + pos, first);
+        if (first < bytes) memcpy(data + first, ring, bytes - first);
+    }
+
+} // namespace CloudMouse::Hardware
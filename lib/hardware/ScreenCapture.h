@@ -0,0 +1,201 @@
+/**
+ * CloudMouse SDK - Display Screenshot and Stream Capture
+ *
+ * The ILI9488 is write-only over SPI, so the screen is captured where pixels leave
+ * LVGL: the flush callback hands every outgoing RGB565 band to captureBand(), which
+ * run-length encodes it into a PSRAM ring of self-contained packets. No framebuffer
+ * is kept on the device; tools/capture/decode_capture.py reassembles the frames.
+ *
+ * Modes:
+ * - Screenshot: the whole screen is invalidated, the next frame is captured, done
+ * - Stream: at most `fps` frames per second; the first frame is full, later frames
+ *   only carry the bands LVGL redrew. Bands flushed between captured frames are
+ *   merged into one rectangle that is invalidated again before the next capture,
+ *   so the decoder's canvas never misses an update.
+ *
+ * Sinks:
+ * - SERIAL_PORT: Core drains packets on Core 0 between log lines (USB CDC)
+ * - HTTP: WebServerManager "/capture" streams one screenshot as the response body
+ * - WEBSOCKET: DisplayMirror forwards the stream to a browser viewer
+ * - Host builds: the runner writes packets to a file ("capture" script command)
+ *
+ * Indexed render mode: L8 bands are expanded through the palette LUT while encoding,
+ * so the stream is RGB565 in both modes (runs are detected on the 8-bit values)
+ *
+ * Stream Format (all values little-endian):
+ *   Packet: "CMCP" | flags u8 | seq u16 | len u16 | payload[len] | fletcher16 u16
+ *           flags: bit0 payload starts a frame, bit1 payload ends a frame
+ *           checksum covers flags, seq, len and payload
+ *   Payload bytes of consecutive packets form the record stream:
+ *     'F' frame u32 | time_ms u32 | width u16 | height u16 | flags u8
+ *         flags: bit0 full frame (keyframe), bit1 byte-swapped RGB565
+ *     'B' x u16 | y u16 | w u16 | h u16 | runs until w*h pixels are covered
+ *         run header u16: bit15 set = next pixel repeated (header & 0x7FFF) times,
+ *         clear = (header) literal pixels follow
+ *     'E' end of frame
+ *
+ * Overflow:
+ * - A frame that does not fit into the ring is dropped whole and the next captured
+ *   frame is a keyframe; the decoder resynchronises on frame-start packets
+ *
+ * Thread Safety:
+ * - Control and render hooks: UI task only
+ * - readPacket(): one consumer task at a time (single-producer/single-consumer ring)
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <atomic>
+
+// PSRAM ring holding encoded packets until the sink drains them (allocated on first use)
+#ifndef CAPTURE_RING_BYTES
+#define CAPTURE_RING_BYTES (192 * 1024)
+#endif
+
+// Payload bytes per packet
+#ifndef CAPTURE_PACKET_PAYLOAD
+#define CAPTURE_PACKET_PAYLOAD 1024
+#endif
+
+// Magic + flags + seq + len + payload + checksum
+#define CAPTURE_PACKET_MAX_BYTES (CAPTURE_PACKET_PAYLOAD + 11)
+
+namespace CloudMouse::Hardware
+{
+    enum class CaptureMode : uint8_t
+    {
+        OFF,
+        SCREENSHOT,
+        STREAM
+    };
+
+    enum class CaptureSink : uint8_t
+    {
+        SERIAL_PORT,
+        HTTP,
+        WEBSOCKET
+    };
+
+    class ScreenCapture
+    {
+    public:
+        ~ScreenCapture();
+
+        // ========================================================================
+        // CONTROL (UI task)
+        // ========================================================================
+
+        /**
+         * Capture the complete screen on the next frame
+         *
+         * @return false if the PSRAM ring could not be allocated
+         */
+        bool requestScreenshot(CaptureSink sink);
+
+        /**
+         * Capture changed bands continuously, at most fps frames per second
+         *
+         * @return false if the PSRAM ring could not be allocated
+         */
+        bool startStream(uint8_t fps, CaptureSink sink);
+        void stop();
+
+        CaptureMode getMode() const { return mode; }
+        CaptureSink getSink() const { return sink.load(std::memory_order_relaxed); }
+        void print() const;
+
+        // ========================================================================
+        // RENDER PATH HOOKS (called by DisplayManager)
+        // ========================================================================
+
+        /**
+         * Before lv_timer_handler(): arms the coming frame when a capture is due and
+         * invalidates what the decoder has not seen yet
+         */
+        void prepareFrame(lv_display_t *disp);
+        void captureBand(const lv_area_t *area, const uint8_t *px_map);
+        void endFrame();
+
+        /**
+         * Indexed render mode: bands hold L8 values that are recorded as RGB565
+         * through lut (IndexedPalette). nullptr for RGB565 bands.
+         */
+        void setIndexedLut(const uint16_t *lut) { indexedLut = lut; }
+
+        // ========================================================================
+        // CONSUMER
+        // ========================================================================
+
+        /**
+         * Copy the oldest complete packet into dst
+         *
+         * @param max Size of dst, at least CAPTURE_PACKET_MAX_BYTES
+         * @return Packet size, 0 when the ring is empty
+         */
+        size_t readPacket(uint8_t *dst, size_t max);
+        bool hasData() const { return head.load(std::memory_order_acquire) != tail.load(std::memory_order_relaxed); }
+
+        /**
+         * True if the packet carries the last record of a frame
+         */
+        static bool endsFrame(const uint8_t *packet, size_t size) { return size > 4 && (packet[4] & PACKET_FRAME_END); }
+
+        static constexpr uint8_t PACKET_FRAME_START = 0x01;
+        static constexpr uint8_t PACKET_FRAME_END = 0x02;
+
+    private:
+        CaptureMode mode = CaptureMode::OFF;
+        std::atomic<CaptureSink> sink{CaptureSink::SERIAL_PORT};
+        uint32_t intervalMs = 0;
+        uint32_t nextDueMs = 0;
+
+        // Frame state
+        bool armed = false;
+        bool frameOpen = false;
+        bool keyframe = false;
+        bool needKeyframe = true;
+        bool dropping = false;
+        uint16_t width = 0;
+        uint16_t height = 0;
+        const uint16_t *indexedLut = nullptr;
+
+        // Bands flushed while not armed (stream mode), redrawn before the next capture
+        lv_area_t skipped = {};
+        bool hasSkipped = false;
+
+        // Statistics
+        uint32_t framesCaptured = 0;
+        uint32_t framesDropped = 0;
+        uint64_t pixelsCaptured = 0;
+        uint64_t bytesEncoded = 0;
+        uint64_t encodeUs = 0;
+
+        // Packet being filled
+        uint8_t packet[CAPTURE_PACKET_MAX_BYTES];
+        uint16_t packetLen = 0;
+        uint8_t packetFlags = 0;
+        uint16_t sequence = 0;
+
+        // Single-producer / single-consumer ring of [u16 size][packet] entries
+        uint8_t *ring = nullptr;
+        std::atomic<uint32_t> head{0};
+        std::atomic<uint32_t> tail{0};
+
+        bool allocateRing();
+        void openFrame();
+        void put(const void *data, size_t bytes);
+        void put8(uint8_t value) { put(&value, 1); }
+        void put16(uint16_t value);
+        void put32(uint32_t value);
+        template <typename Pixel>
+        void encodeRle(const Pixel *pixels, uint32_t count);
+        void putPixels(const uint16_t *pixels, uint32_t count) { put(pixels, count * 2); }
+        void putPixels(const uint8_t *values, uint32_t count);
+        void commitPacket(bool frameEnd);
+        void ringWrite(uint32_t pos, const uint8_t *data, size_t bytes);
+        void ringRead(uint32_t pos, uint8_t *data, size_t bytes) const;
+    };
+
+} // namespace CloudMouse::Hardware
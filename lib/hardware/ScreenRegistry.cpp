@@ -0,0 +1,349 @@
+/**
+ * CloudMouse SDK - Lazy LVGL Screen Registry Implementation
+ */
+
+#include "./ScreenRegistry.h"
+#include <lvgl_private.h> // Animation list (LV_GLOBAL_DEFAULT()->anim_state)
+
+namespace CloudMouse::Hardware
+{
+    namespace
+    {
+        typedef void (*AnimationVisitor)(lv_anim_t *anim, void *arg);
+
+        // Animations on LVGL objects use the object as their var
+        void visitAnimations(lv_obj_t *obj, AnimationVisitor visit, void *arg)
+        {
+            lv_ll_t *list = &LV_GLOBAL_DEFAULT()->anim_state.anim_ll;
+            for (lv_anim_t *a = (lv_anim_t *)lv_ll_get_head(list); a; a = (lv_anim_t *)lv_ll_get_next(list, a))
+            {
+                if (a->var == obj) visit(a, arg);
+            }
+
+            const uint32_t children = lv_obj_get_child_count(obj);
+            for (uint32_t i = 0; i < children; i++)
+            {
+                visitAnimations(lv_obj_get_child(obj, i), visit, arg);
+            }
+        }
+
+        void pauseAnimation(lv_anim_t *a, void *)
+        {
+            lv_anim_pause(a);
+        }
+
+        void resumeAnimation(lv_anim_t *a, void *)
+        {
+            if (lv_anim_is_paused(a)) lv_anim_resume(a);
+        }
+
+        void countAnimation(lv_anim_t *a, void *arg)
+        {
+            ScreenAnimationCount *count = (ScreenAnimationCount *)arg;
+            if (lv_anim_is_paused(a)) count->paused++;
+            else count->running++;
+        }
+    }
+
+    // ============================================================================
+    // REGISTRATION
+    // ============================================================================
+
+    void ScreenRegistry::setCallbacks(ScreenBuildCallback build, ScreenReleaseCallback release, void *context)
+    {
+        buildCallback = build;
+        releaseCallback = release;
+        callbackContext = context;
+    }
+
+    bool ScreenRegistry::add(uint8_t id, const char *name, ScreenRetention retention)
+    {
+        if (id >= SCREEN_REGISTRY_MAX_SCREENS) return false;
+
+        entries[id] = ScreenEntry();
+        entries[id].name = name;
+        entries[id].retention = retention;
+        names[id] = name;
+        if (id >= count) count = id + 1;
+        return true;
+    }
+
+    // ============================================================================
+    // LOAD / TEARDOWN
+    // ============================================================================
+
+    lv_obj_t *ScreenRegistry::load(uint8_t id)
+    {
+        if (id >= count || !entries[id].name) return nullptr;
+
+        ScreenEntry &entry = entries[id];
+
+        // A cleaned screen is rebuilt from scratch; the old root goes once the new one is shown
+        lv_obj_t *staleRoot = nullptr;
+        if (entry.stale)
+        {
+            staleRoot = entry.root;
+            entry.root = nullptr;
+            entry.stale = false;
+        }
+
+        if (!entry.root && !build(id))
+        {
+            entry.root = staleRoot;
+            return nullptr;
+        }
+
+        entry.loads++;
+        entry.lastUsedMs = millis();
+
+        const int previous = active;
+        if (previous != id)
+        {
+            lv_screen_load(entry.root);
+            active = id;
+        }
+        else if (staleRoot)
+        {
+            lv_screen_load(entry.root);
+        }
+
+        if (staleRoot)
+        {
+            lv_obj_delete(staleRoot);
+        }
+
+        if (lifecycleCallback && (previous != id || staleRoot))
+        {
+            lifecycleCallback(id, ScreenLifecycleEvent::LOADED, callbackContext);
+        }
+
+        if (previous >= 0 && previous != id)
+        {
+            if (lifecycleCallback)
+            {
+                lifecycleCallback(previous, ScreenLifecycleEvent::UNLOADED, callbackContext);
+            }
+            leave(previous);
+        }
+
+        return entry.root;
+    }
+
+    bool ScreenRegistry::build(uint8_t id)
+    {
+        if (!buildCallback) return false;
+
+        ScreenEntry &entry = entries[id];
+        const uint32_t heapBefore = heapUsed();
+        const uint32_t start = micros();
+
+        entry.root = buildCallback(id, callbackContext);
+        if (!entry.root)
+        {
+            Serial.printf("❌ Screen '%s' build failed\n", entry.name);
+            return false;
+        }
+
+        entry.buildUs = micros() - start;
+        entry.heapBytes = (int32_t)(heapUsed() - heapBefore);
+        entry.builds++;
+
+        Serial.printf("🧱 Screen '%s' built in %lu us (%ld bytes LVGL heap)\n",
+                      entry.name, (unsigned long)entry.buildUs, (long)entry.heapBytes);
+        return true;
+    }
+
+    void ScreenRegistry::leave(uint8_t id)
+    {
+        switch (entries[id].retention)
+        {
+        case ScreenRetention::DESTROY_ON_LEAVE:
+            destroy(id);
+            break;
+
+        case ScreenRetention::CACHED:
+            evictCached();
+            break;
+
+        default:
+            // Stale screens are never worth keeping
+            if (entries[id].stale) destroy(id);
+            break;
+        }
+    }
+
+    void ScreenRegistry::evictCached()
+    {
+        while (true)
+        {
+            int resident = 0;
+            int oldest = -1;
+
+            for (uint8_t i = 0; i < count; i++)
+            {
+                const ScreenEntry &e = entries[i];
+                if (i == active || !e.root || e.retention != ScreenRetention::CACHED) continue;
+
+                resident++;
+                if (oldest < 0 || (int32_t)(e.lastUsedMs - entries[oldest].lastUsedMs) < 0)
+                {
+                    oldest = i;
+                }
+            }
+
+            if (resident <= SCREEN_REGISTRY_CACHE_SIZE) return;
+            destroy(oldest);
+        }
+    }
+
+    void ScreenRegistry::destroy(uint8_t id)
+    {
+        if (id >= count || id == active || !entries[id].root) return;
+
+        ScreenEntry &entry = entries[id];
+        const uint32_t heapBefore = heapUsed();
+
+        releaseTimers(id);
+        lv_obj_delete(entry.root);
+        entry.root = nullptr;
+        entry.stale = false;
+        entry.suspended = false;
+
+        if (releaseCallback)
+        {
+            releaseCallback(id, callbackContext);
+        }
+
+        Serial.printf("🧹 Screen '%s' destroyed (%ld bytes LVGL heap released)\n",
+                      entry.name, (long)((int32_t)(heapBefore - heapUsed())));
+    }
+
+    void ScreenRegistry::cleanActive()
+    {
+        if (active < 0 || !entries[active].root) return;
+
+        releaseTimers(active);
+        lv_obj_clean(entries[active].root);
+        entries[active].stale = true;
+
+        if (releaseCallback)
+        {
+            releaseCallback(active, callbackContext);
+        }
+    }
+
+    // ============================================================================
+    // ANIMATIONS AND TIMERS
+    // ============================================================================
+
+    bool ScreenRegistry::addTimer(uint8_t id, lv_timer_t *timer)
+    {
+        if (id >= count || !timer || entries[id].timerCount >= SCREEN_REGISTRY_MAX_TIMERS) return false;
+
+        ScreenEntry &entry = entries[id];
+        entry.timers[entry.timerCount++] = timer;
+        if (entry.suspended) lv_timer_pause(timer);
+        return true;
+    }
+
+    void ScreenRegistry::releaseTimers(uint8_t id)
+    {
+        ScreenEntry &entry = entries[id];
+        for (uint8_t i = 0; i < entry.timerCount; i++)
+        {
+            lv_timer_delete(entry.timers[i]);
+            entry.timers[i] = nullptr;
+        }
+        entry.timerCount = 0;
+    }
+
+    void ScreenRegistry::suspend(uint8_t id)
+    {
+        if (id >= count || !entries[id].root || entries[id].suspended) return;
+
+        ScreenEntry &entry = entries[id];
+        visitAnimations(entry.root, pauseAnimation, nullptr);
+        for (uint8_t i = 0; i < entry.timerCount; i++)
+        {
+            lv_timer_pause(entry.timers[i]);
+        }
+        entry.suspended = true;
+    }
+
+    void ScreenRegistry::resume(uint8_t id)
+    {
+        if (id >= count || !entries[id].root || !entries[id].suspended) return;
+
+        ScreenEntry &entry = entries[id];
+        visitAnimations(entry.root, resumeAnimation, nullptr);
+        for (uint8_t i = 0; i < entry.timerCount; i++)
+        {
+            lv_timer_resume(entry.timers[i]);
+        }
+        entry.suspended = false;
+    }
+
+    ScreenAnimationCount ScreenRegistry::countAnimations(uint8_t id) const
+    {
+        ScreenAnimationCount result;
+        if (id >= count || !entries[id].root) return result;
+
+        visitAnimations(entries[id].root, countAnimation, &result);
+        return result;
+    }
+
+    // ============================================================================
+    // REPORTING
+    // ============================================================================
+
+    const char *ScreenRegistry::getName(uint8_t id) const
+    {
+        return id < SCREEN_REGISTRY_MAX_SCREENS && entries[id].name ? entries[id].name : "?";
+    }
+
+    const ScreenEntry &ScreenRegistry::getEntry(uint8_t id) const
+    {
+        if (id >= SCREEN_REGISTRY_MAX_SCREENS) id = SCREEN_REGISTRY_MAX_SCREENS - 1;
+        return entries[id];
+    }
+
+    uint32_t ScreenRegistry::heapUsed()
+    {
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        return mon.total_size - mon.free_size;
+    }
+
+    void ScreenRegistry::print() const
+    {
+        static const char *const retentionNames[] = {"keep", "cached", "on-leave"};
+
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+
+        Serial.println("\n🧱 SCREENS_START");
+        Serial.println("  screen            policy    state     builds  loads   heap_B   build_us  anims(run/paused)  timers");
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            const ScreenEntry &e = entries[i];
+            if (!e.name) continue;
+
+            const char *state = !e.root ? "-" : (i == active ? "active" : (e.suspended ? "suspended" : "resident"));
+            const ScreenAnimationCount anims = countAnimations(i);
+            Serial.printf("  %-17s %-9s %-9s %-7lu %-7lu %-8ld %-9lu %u/%-16u %u\n",
+                          e.name, retentionNames[(int)e.retention], state,
+                          (unsigned long)e.builds, (unsigned long)e.loads,
+                          (long)e.heapBytes, (unsigned long)e.buildUs,
+                          anims.running, anims.paused, e.timerCount);
+        }
+
+        Serial.printf("  LVGL animations running (all screens): %lu\n", (unsigned long)lv_anim_count_running());
+
+        Serial.printf("  LVGL heap: %lu / %lu bytes used (%u%% frag, biggest free %lu)\n",
+                      (unsigned long)(mon.total_size - mon.free_size), (unsigned long)mon.total_size,
+                      mon.frag_pct, (unsigned long)mon.free_biggest_size);
+        Serial.println("🧱 SCREENS_END\n");
+    }
+
+} // namespace CloudMouse::Hardware
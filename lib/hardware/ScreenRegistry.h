@@ -0,0 +1,210 @@
+/**
+ * CloudMouse SDK - Lazy LVGL Screen Registry
+ *
+ * Keeps the list of UI screens and builds each one on its first load instead of at
+ * boot. Screens that are rarely shown can be torn down when left, or kept in a small
+ * LRU cache, so their widgets stop occupying the LVGL heap.
+ *
+ * Retention Policies:
+ * - KEEP: built once, never destroyed (home screen)
+ * - CACHED: kept after leaving, evicted least-recently-used first when more than
+ *   SCREEN_REGISTRY_CACHE_SIZE cached screens are inactive
+ * - DESTROY_ON_LEAVE: deleted as soon as another screen is loaded
+ *
+ * Memory Accounting:
+ * - LVGL heap usage is sampled with lv_mem_monitor() around every build and teardown,
+ *   giving the bytes each screen costs while resident
+ * - Build time is measured per screen so slow constructors are visible
+ *
+ * Lifecycle:
+ * - A lifecycle callback is notified when a screen is loaded and when it is left
+ * - suspend()/resume() pause and restart every LVGL animation running on a screen's
+ *   widgets, plus timers registered with addTimer(), so hidden screens cost no CPU
+ * - Running and paused animations per screen are listed by print()
+ *
+ * Thread Safety:
+ * - UI task only (same task that runs lv_timer_handler)
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// Maximum number of screens that can be registered
+#define SCREEN_REGISTRY_MAX_SCREENS 8
+
+// Timers that can be attached to one screen
+#define SCREEN_REGISTRY_MAX_TIMERS 4
+
+// Inactive CACHED screens kept resident before LRU eviction
+#ifndef SCREEN_REGISTRY_CACHE_SIZE
+#define SCREEN_REGISTRY_CACHE_SIZE 1
+#endif
+
+namespace CloudMouse::Hardware
+{
+    enum class ScreenRetention
+    {
+        KEEP,
+        CACHED,
+        DESTROY_ON_LEAVE
+    };
+
+    /**
+     * Build a screen's widget tree and return its root (created with lv_obj_create(NULL))
+     */
+    typedef lv_obj_t *(*ScreenBuildCallback)(uint8_t id, void *context);
+
+    /**
+     * Notification that a screen's widgets were deleted (drop cached widget pointers)
+     */
+    typedef void (*ScreenReleaseCallback)(uint8_t id, void *context);
+
+    enum class ScreenLifecycleEvent
+    {
+        LOADED,
+        UNLOADED
+    };
+
+    /**
+     * Notification that a screen became active or was left (before its retention
+     * policy is applied, so the widgets still exist)
+     */
+    typedef void (*ScreenLifecycleCallback)(uint8_t id, ScreenLifecycleEvent event, void *context);
+
+    /**
+     * Animation counts for one screen's widget tree
+     */
+    struct ScreenAnimationCount
+    {
+        uint16_t running = 0;
+        uint16_t paused = 0;
+    };
+
+    /**
+     * Per-screen bookkeeping
+     */
+    struct ScreenEntry
+    {
+        const char *name = nullptr;
+        ScreenRetention retention = ScreenRetention::KEEP;
+        lv_obj_t *root = nullptr;
+        bool stale = false;           // Children were cleaned, rebuild on next load
+        bool suspended = false;       // Animations and timers paused while hidden
+
+        lv_timer_t *timers[SCREEN_REGISTRY_MAX_TIMERS] = {};
+        uint8_t timerCount = 0;
+
+        uint32_t builds = 0;          // Times the screen was constructed
+        uint32_t loads = 0;           // Times the screen was shown
+        int32_t heapBytes = 0;        // LVGL heap used by the last build
+        uint32_t buildUs = 0;         // Duration of the last build
+        uint32_t lastUsedMs = 0;      // LRU timestamp
+    };
+
+    class ScreenRegistry
+    {
+    public:
+        /**
+         * Set the callbacks shared by all screens
+         *
+         * @param build Called with the screen id when a screen must be constructed
+         * @param release Called after a screen was deleted (may be nullptr)
+         * @param context Passed back to both callbacks
+         */
+        void setCallbacks(ScreenBuildCallback build, ScreenReleaseCallback release, void *context);
+
+        /**
+         * Set the load/leave notification (uses the context given to setCallbacks)
+         */
+        void setLifecycleCallback(ScreenLifecycleCallback lifecycle) { lifecycleCallback = lifecycle; }
+
+        /**
+         * Register a screen under the given id (ids index the registry directly)
+         *
+         * @return false if id is out of range
+         */
+        bool add(uint8_t id, const char *name, ScreenRetention retention);
+
+        /**
+         * Build the screen if needed, make it active and apply the retention policy
+         * of the screen that was left
+         *
+         * @return Screen root, or nullptr if the build failed
+         */
+        lv_obj_t *load(uint8_t id);
+
+        /**
+         * Delete a screen's widgets now (ignored for the active screen)
+         */
+        void destroy(uint8_t id);
+
+        /**
+         * Remove all widgets from the active screen; it is rebuilt on its next load
+         */
+        void cleanActive();
+
+        /**
+         * Attach an LVGL timer to a screen: paused with it, deleted with its widgets
+         *
+         * @return false if the screen has no free timer slot
+         */
+        bool addTimer(uint8_t id, lv_timer_t *timer);
+
+        /**
+         * Pause all animations of a screen's widgets and its registered timers
+         */
+        void suspend(uint8_t id);
+
+        /**
+         * Resume what suspend() paused
+         */
+        void resume(uint8_t id);
+
+        /**
+         * Count running and paused animations on a screen's widgets
+         */
+        ScreenAnimationCount countAnimations(uint8_t id) const;
+
+        bool isBuilt(uint8_t id) const { return id < SCREEN_REGISTRY_MAX_SCREENS && entries[id].root; }
+        lv_obj_t *get(uint8_t id) const { return id < SCREEN_REGISTRY_MAX_SCREENS ? entries[id].root : nullptr; }
+        int getActive() const { return active; }
+
+        const char *getName(uint8_t id) const;
+        const ScreenEntry &getEntry(uint8_t id) const;
+
+        /**
+         * Screen names indexed by id, for reports keyed by screen (e.g. RenderStats)
+         */
+        const char *const *getNames() const { return names; }
+        uint8_t getCount() const { return count; }
+
+        /**
+         * Print residency, build cost and LVGL heap usage per screen to Serial
+         */
+        void print() const;
+
+        /**
+         * Bytes currently allocated from the LVGL heap (lv_mem_monitor)
+         */
+        static uint32_t heapUsed();
+
+    private:
+        ScreenEntry entries[SCREEN_REGISTRY_MAX_SCREENS];
+        const char *names[SCREEN_REGISTRY_MAX_SCREENS] = {};
+        uint8_t count = 0;
+        int active = -1;
+
+        ScreenBuildCallback buildCallback = nullptr;
+        ScreenReleaseCallback releaseCallback = nullptr;
+        ScreenLifecycleCallback lifecycleCallback = nullptr;
+        void *callbackContext = nullptr;
+
+        bool build(uint8_t id);
+        void leave(uint8_t id);
+        void evictCached();
+        void releaseTimers(uint8_t id);
+    };
+
+} // namespace CloudMouse::Hardware
@@ -0,0 +1,24 @@
+/**
+ * CloudMouse SDK - UI Font Selection
+ *
+ * Maps the font roles used in lib/config/UiStrings.h to LVGL fonts. When
+ * tools/fonts/subset_fonts.py has generated lib/fonts/, the roles resolve to subset
+ * fonts that only contain the glyphs of their string table section; otherwise the
+ * full built-in Montserrat sizes are used.
+ */
+
+#pragma once
+
+#include <lvgl.h>
+
+#if __has_include("../fonts/UiFontsGenerated.h")
+#include "../fonts/UiFontsGenerated.h"
+#endif
+
+#ifndef UI_FONT_TITLE
+#define UI_FONT_TITLE (&lv_font_montserrat_28)
+#endif
+
+#ifndef UI_FONT_STATUS
+#define UI_FONT_STATUS (&lv_font_montserrat_20)
+#endif
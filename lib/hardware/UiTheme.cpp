@@ -0,0 +1,125 @@
+/**
+ * CloudMouse SDK - Shared LVGL Theme Styles Implementation
+ */
+
+#include "./UiTheme.h"
+
+namespace CloudMouse::Hardware
+{
+    lv_style_t UiTheme::styles[(uint8_t)UiStyle::COUNT];
+    bool UiTheme::ready = false;
+    bool UiTheme::shared = true;
+
+    const uint32_t UiTheme::PALETTE[] = {
+        COLOR_BG, COLOR_TEXT, COLOR_ACCENT, COLOR_SUCCESS, COLOR_WARNING,
+        COLOR_HEADER, COLOR_HINT, COLOR_SETUP_BG, COLOR_CONFIRMED_BG};
+    const uint8_t UiTheme::PALETTE_SIZE = sizeof(PALETTE) / sizeof(PALETTE[0]);
+
+    namespace
+    {
+        // Every property set in init(); copyToLocal() only needs to look these up
+        const lv_style_prop_t THEME_PROPS[] = {
+            LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA, LV_STYLE_BORDER_WIDTH, LV_STYLE_RADIUS,
+            LV_STYLE_TEXT_COLOR, LV_STYLE_TEXT_FONT, LV_STYLE_ARC_COLOR,
+            LV_STYLE_OUTLINE_COLOR, LV_STYLE_OUTLINE_WIDTH, LV_STYLE_OUTLINE_PAD,
+            LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM, LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT};
+
+        const uint8_t QR_QUIET_ZONE_PX = 8;
+    }
+
+    // ============================================================================
+    // INITIALIZATION
+    // ============================================================================
+
+    void UiTheme::init(const lv_font_t *titleFont, const lv_font_t *statusFont)
+    {
+        if (!ready)
+        {
+            for (lv_style_t &style : styles) lv_style_init(&style);
+
+            lv_style_set_bg_color(get(UiStyle::SCREEN), lv_color_hex(COLOR_BG));
+            lv_style_set_bg_color(get(UiStyle::SCREEN_SETUP), lv_color_hex(COLOR_SETUP_BG));
+            lv_style_set_bg_color(get(UiStyle::SCREEN_CONFIRMED), lv_color_hex(COLOR_CONFIRMED_BG));
+
+            lv_style_t *header = get(UiStyle::HEADER);
+            lv_style_set_bg_color(header, lv_color_hex(COLOR_HEADER));
+            lv_style_set_border_width(header, 0);
+            lv_style_set_radius(header, 0);
+
+            lv_style_set_text_color(get(UiStyle::HEADER_LABEL), lv_color_hex(COLOR_TEXT));
+            lv_style_set_text_color(get(UiStyle::TITLE), lv_color_hex(COLOR_ACCENT));
+            lv_style_set_text_color(get(UiStyle::HEADING), lv_color_hex(COLOR_ACCENT));
+            lv_style_set_text_color(get(UiStyle::HEADING_SUCCESS), lv_color_hex(COLOR_SUCCESS));
+            lv_style_set_text_color(get(UiStyle::STATUS), lv_color_hex(COLOR_TEXT));
+            lv_style_set_text_color(get(UiStyle::BODY), lv_color_hex(COLOR_TEXT));
+            lv_style_set_text_color(get(UiStyle::HINT), lv_color_hex(COLOR_HINT));
+
+            // Light border outside the symbol so it scans on dark screen backgrounds
+            lv_style_t *qr = get(UiStyle::QR);
+            lv_style_set_outline_color(qr, lv_color_white());
+            lv_style_set_outline_width(qr, QR_QUIET_ZONE_PX);
+            lv_style_set_outline_pad(qr, 0);
+
+            lv_style_set_arc_color(get(UiStyle::SPINNER_ARC), lv_color_hex(COLOR_ACCENT));
+
+            lv_style_t *row = get(UiStyle::LIST_ROW);
+            lv_style_set_bg_color(row, lv_color_hex(COLOR_HEADER));
+            lv_style_set_bg_opa(row, LV_OPA_COVER);
+            lv_style_set_text_color(row, lv_color_hex(COLOR_TEXT));
+
+            lv_style_t *selectedRow = get(UiStyle::LIST_ROW_SELECTED);
+            lv_style_set_bg_color(selectedRow, lv_color_hex(COLOR_ACCENT));
+            lv_style_set_text_color(selectedRow, lv_color_hex(COLOR_BG));
+
+            // Translucent so the screen below stays readable
+            lv_style_t *hud = get(UiStyle::HUD);
+            lv_style_set_bg_color(hud, lv_color_hex(COLOR_BG));
+            lv_style_set_bg_opa(hud, LV_OPA_70);
+            lv_style_set_text_color(hud, lv_color_hex(COLOR_SUCCESS));
+            lv_style_set_pad_all(hud, 4);
+
+            ready = true;
+            Serial.printf("✅ UiTheme: %d shared styles\n", (int)UiStyle::COUNT);
+        }
+
+        // Fonts may be RAM clones from FontCache, resolved after the first init
+        lv_style_set_text_font(get(UiStyle::TITLE), titleFont);
+        lv_style_set_text_font(get(UiStyle::STATUS), statusFont);
+    }
+
+    // ============================================================================
+    // STYLE ATTACHMENT
+    // ============================================================================
+
+    void UiTheme::apply(lv_obj_t *obj, UiStyle style, lv_style_selector_t selector)
+    {
+        if (!obj || style >= UiStyle::COUNT) return;
+
+        if (shared)
+        {
+            lv_obj_add_style(obj, get(style), selector);
+        }
+        else
+        {
+            copyToLocal(obj, get(style), selector);
+        }
+    }
+
+    void UiTheme::setShared(bool enabled)
+    {
+        shared = enabled;
+    }
+
+    void UiTheme::copyToLocal(lv_obj_t *obj, const lv_style_t *style, lv_style_selector_t selector)
+    {
+        for (lv_style_prop_t prop : THEME_PROPS)
+        {
+            lv_style_value_t value;
+            if (lv_style_get_prop(style, prop, &value) == LV_STYLE_RES_FOUND)
+            {
+                lv_obj_set_local_style_prop(obj, prop, value, selector);
+            }
+        }
+    }
+
+} // namespace CloudMouse::Hardware
@@ -0,0 +1,110 @@
+/**
+ * CloudMouse SDK - Shared LVGL Theme Styles
+ *
+ * Every widget used to receive its colours and fonts through lv_obj_set_style_*()
+ * calls, which gives each object its own local style list on the LVGL heap and makes
+ * LVGL resolve those properties per object while rendering. UiTheme builds one
+ * lv_style_t per visual role once at startup; screens attach them with apply(), so
+ * all labels of a role share a single style and only hold a pointer to it.
+ *
+ * Roles:
+ * - Screen backgrounds (default, setup, confirmed)
+ * - Header bar and header label
+ * - Title (title font), heading (default font), success heading
+ * - Status (status font), body text, hint text
+ * - QR code quiet zone and spinner indicator arc
+ * - List rows and the selected list row (VirtualList)
+ *
+ * Benchmarking:
+ * - setShared(false) makes apply() copy the role's properties into local styles
+ *   instead, reproducing the former per-object styling for A/B comparisons
+ *   (see DisplayManager::runStyleBenchmark)
+ *
+ * Thread Safety:
+ * - UI task only; styles live for the whole program
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+namespace CloudMouse::Hardware
+{
+    enum class UiStyle : uint8_t
+    {
+        SCREEN,
+        SCREEN_SETUP,
+        SCREEN_CONFIRMED,
+        HEADER,
+        HEADER_LABEL,
+        TITLE,
+        HEADING,
+        HEADING_SUCCESS,
+        STATUS,
+        BODY,
+        HINT,
+        QR,
+        SPINNER_ARC,
+        LIST_ROW,
+        LIST_ROW_SELECTED,
+        HUD,
+        COUNT
+    };
+
+    class UiTheme
+    {
+    public:
+        // ========================================================================
+        // UI COLOR SCHEME DEFINITIONS (lv_color_hex values)
+        // ========================================================================
+
+        static const uint32_t COLOR_BG = 0x0000;
+        static const uint32_t COLOR_TEXT = 0xFFFF;
+        static const uint32_t COLOR_ACCENT = 0x07FF;
+        static const uint32_t COLOR_SUCCESS = 0x07E0;
+        static const uint32_t COLOR_WARNING = 0xFD20;
+        static const uint32_t COLOR_HEADER = 0x222222;
+        static const uint32_t COLOR_HINT = 0x888888;
+        static const uint32_t COLOR_SETUP_BG = 0x7BEF;     // TFT_DARKGRAY
+        static const uint32_t COLOR_CONFIRMED_BG = 0x03E0; // TFT_DARKGREEN
+
+        // Every scheme colour, registered with the indexed render mode palette
+        static const uint32_t PALETTE[];
+        static const uint8_t PALETTE_SIZE;
+
+        /**
+         * Build all role styles (once; later calls only update the fonts)
+         *
+         * @param titleFont Font for TITLE
+         * @param statusFont Font for STATUS
+         */
+        static void init(const lv_font_t *titleFont, const lv_font_t *statusFont);
+
+        /**
+         * Attach a role style to an object
+         *
+         * @param obj Target widget
+         * @param style Role
+         * @param selector Part/state the style applies to (e.g. LV_PART_INDICATOR)
+         */
+        static void apply(lv_obj_t *obj, UiStyle style, lv_style_selector_t selector = 0);
+
+        /**
+         * Shared styles (true, default) or per-object local copies (false)
+         * Only affects objects styled afterwards.
+         */
+        static void setShared(bool shared);
+        static bool isShared() { return shared; }
+
+        static lv_style_t *get(UiStyle style) { return &styles[(uint8_t)style]; }
+
+    private:
+        static lv_style_t styles[(uint8_t)UiStyle::COUNT];
+        static bool ready;
+        static bool shared;
+
+        static void copyToLocal(lv_obj_t *obj, const lv_style_t *style, lv_style_selector_t selector);
+    };
+
+} // namespace CloudMouse::Hardware
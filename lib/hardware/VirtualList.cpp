@@ -0,0 +1,284 @@
+/**
+ * CloudMouse SDK - Virtualised LVGL List Implementation
+ */
+
+#include "./VirtualList.h"
+#include "./UiTheme.h"
+
+namespace CloudMouse::Hardware
+{
+    // ============================================================================
+    // CREATION
+    // ============================================================================
+
+    lv_obj_t *VirtualList::create(lv_obj_t *parent, int32_t width, int32_t height, int32_t rowHeight)
+    {
+        if (container)
+        {
+            lv_obj_delete(container); // Detaches through LV_EVENT_DELETE
+        }
+
+        if (rowHeight <= 0 || height <= 0) return nullptr;
+
+        const int32_t visible = (height + rowHeight - 1) / rowHeight + 1; // Partial rows at both edges
+        const int32_t pool = visible + 2 * VIRTUAL_LIST_PREFETCH_ROWS;
+        if (pool > VIRTUAL_LIST_MAX_ROWS)
+        {
+            Serial.printf("❌ VirtualList: %ld rows needed, VIRTUAL_LIST_MAX_ROWS is %d\n",
+                          (long)pool, VIRTUAL_LIST_MAX_ROWS);
+            return nullptr;
+        }
+
+        this->rowHeight = rowHeight;
+        viewHeight = height;
+        scrollY = scrollTarget = 0;
+        selected = 0;
+
+        // Geometry shared by every row of this list
+        if (rowStyleReady) lv_style_reset(&rowStyle);
+        lv_style_init(&rowStyle);
+        lv_style_set_width(&rowStyle, width);
+        lv_style_set_height(&rowStyle, rowHeight);
+        lv_style_set_pad_left(&rowStyle, 12);
+        lv_style_set_pad_right(&rowStyle, 12);
+        lv_style_set_pad_top(&rowStyle, (rowHeight - lv_font_get_line_height(LV_FONT_DEFAULT)) / 2);
+        rowStyleReady = true;
+
+        container = lv_obj_create(parent);
+        lv_obj_remove_style_all(container);
+        lv_obj_set_size(container, width, height);
+        lv_obj_remove_flag(container, LV_OBJ_FLAG_SCROLLABLE); // Scrolling is virtual
+        lv_obj_set_user_data(container, this);
+        lv_obj_add_event_cb(container, eventCb, LV_EVENT_ALL, this);
+
+        rowCount = (uint8_t)pool;
+        for (uint8_t i = 0; i < rowCount; i++)
+        {
+            lv_obj_t *label = lv_label_create(container);
+            lv_label_set_long_mode(label, LV_LABEL_LONG_MODE_DOTS);
+            lv_obj_add_style(label, &rowStyle, 0);
+            UiTheme::apply(label, UiStyle::LIST_ROW);
+            UiTheme::apply(label, UiStyle::LIST_ROW_SELECTED, LV_STATE_CHECKED);
+            lv_obj_add_flag(label, LV_OBJ_FLAG_HIDDEN);
+            rows[i] = {label, -1};
+        }
+
+        layout();
+        return container;
+    }
+
+    void VirtualList::setDataSource(VirtualListBindCallback bind, VirtualListSelectCallback select, void *context)
+    {
+        bindCallback = bind;
+        selectCallback = select;
+        callbackContext = context;
+        refresh();
+    }
+
+    // ============================================================================
+    // CONTENT AND SELECTION
+    // ============================================================================
+
+    void VirtualList::setCount(uint32_t newCount)
+    {
+        count = newCount;
+        if (selected >= count) selected = count ? count - 1 : 0;
+
+        if (scrollTarget > maxScroll())
+        {
+            scrollTo(maxScroll(), false);
+        }
+        refresh();
+    }
+
+    void VirtualList::setSelected(uint32_t index, bool animate)
+    {
+        if (count == 0) return;
+        selected = index < count ? index : count - 1;
+
+        // Smallest scroll that brings the selected row fully into view
+        const int32_t top = (int32_t)selected * rowHeight;
+        int32_t target = scrollTarget;
+        if (top < target) target = top;
+        if (top + rowHeight > target + viewHeight) target = top + rowHeight - viewHeight;
+
+        scrollTo(target, animate);
+        layout(); // Selection highlight even when no scroll is needed
+    }
+
+    void VirtualList::refresh()
+    {
+        for (uint8_t i = 0; i < rowCount; i++)
+        {
+            rows[i].index = -1;
+        }
+        layout();
+    }
+
+    void VirtualList::focus(lv_group_t *group)
+    {
+        if (!container || !group) return;
+
+        if (lv_obj_get_group(container) != group)
+        {
+            lv_group_add_obj(group, container);
+        }
+        lv_group_focus_obj(container);
+        lv_group_set_editing(group, true); // Rotation arrives as LV_KEY_LEFT/RIGHT
+    }
+
+    // ============================================================================
+    // VIRTUALISATION
+    // ============================================================================
+
+    void VirtualList::layout()
+    {
+        if (!container) return;
+
+        // Window of bound indices: visible rows plus prefetch on both sides
+        int32_t first = scrollY / rowHeight - VIRTUAL_LIST_PREFETCH_ROWS;
+        int32_t last = (scrollY + viewHeight + rowHeight - 1) / rowHeight + VIRTUAL_LIST_PREFETCH_ROWS;
+        if (first < 0) first = 0;
+        if (last > (int32_t)count) last = (int32_t)count;
+
+        // Free rows that left the window
+        for (uint8_t i = 0; i < rowCount; i++)
+        {
+            Row &row = rows[i];
+            if (row.index >= 0 && (row.index < first || row.index >= last))
+            {
+                row.index = -1;
+                lv_obj_add_flag(row.label, LV_OBJ_FLAG_HIDDEN);
+            }
+        }
+
+        // Bind newly exposed indices to free rows
+        for (int32_t index = first; index < last; index++)
+        {
+            Row *owner = nullptr;
+            Row *spare = nullptr;
+            for (uint8_t i = 0; i < rowCount && !owner; i++)
+            {
+                if (rows[i].index == index) owner = &rows[i];
+                else if (rows[i].index < 0 && !spare) spare = &rows[i];
+            }
+
+            if (!owner && spare)
+            {
+                bindRow(*spare, (uint32_t)index);
+            }
+        }
+
+        // Position bound rows; set_y and state changes are no-ops when unchanged
+        for (uint8_t i = 0; i < rowCount; i++)
+        {
+            Row &row = rows[i];
+            if (row.index < 0) continue;
+
+            lv_obj_set_y(row.label, row.index * rowHeight - scrollY);
+            lv_obj_set_state(row.label, LV_STATE_CHECKED, (uint32_t)row.index == selected);
+        }
+    }
+
+    void VirtualList::bindRow(Row &row, uint32_t index)
+    {
+        row.index = (int32_t)index;
+        lv_obj_remove_flag(row.label, LV_OBJ_FLAG_HIDDEN);
+
+        if (bindCallback)
+        {
+            bindCallback(index, row.label, callbackContext);
+        }
+        binds++;
+    }
+
+    int32_t VirtualList::maxScroll() const
+    {
+        const int32_t content = (int32_t)count * rowHeight;
+        return content > viewHeight ? content - viewHeight : 0;
+    }
+
+    void VirtualList::scrollTo(int32_t y, bool animate)
+    {
+        if (!container) return;
+
+        if (y < 0) y = 0;
+        if (y > maxScroll()) y = maxScroll();
+        if (y == scrollTarget && y == scrollY) return;
+
+        scrollTarget = y;
+        lv_anim_delete(container, scrollAnimCb);
+
+        if (!animate || VIRTUAL_LIST_SCROLL_MS == 0)
+        {
+            scrollY = y;
+            layout();
+            return;
+        }
+
+        // Animation var is the container, so hidden screens suspend it with their objects
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, container);
+        lv_anim_set_exec_cb(&a, scrollAnimCb);
+        lv_anim_set_values(&a, scrollY, y);
+        lv_anim_set_duration(&a, VIRTUAL_LIST_SCROLL_MS);
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+        lv_anim_start(&a);
+    }
+
+    // ============================================================================
+    // LVGL CALLBACKS
+    // ============================================================================
+
+    void VirtualList::scrollAnimCb(void *var, int32_t value)
+    {
+        VirtualList *self = (VirtualList *)lv_obj_get_user_data((lv_obj_t *)var);
+        if (!self) return;
+
+        self->scrollY = value;
+        self->layout();
+    }
+
+    void VirtualList::eventCb(lv_event_t *e)
+    {
+        VirtualList *self = (VirtualList *)lv_event_get_user_data(e);
+
+        switch (lv_event_get_code(e))
+        {
+        case LV_EVENT_KEY:
+        {
+            const uint32_t key = lv_event_get_key(e);
+            if (self->count == 0) break;
+
+            if (key == LV_KEY_RIGHT || key == LV_KEY_DOWN)
+            {
+                if (self->selected + 1 < self->count) self->setSelected(self->selected + 1);
+            }
+            else if (key == LV_KEY_LEFT || key == LV_KEY_UP)
+            {
+                if (self->selected > 0) self->setSelected(self->selected - 1);
+            }
+            break;
+        }
+
+        case LV_EVENT_CLICKED:
+            if (self->selectCallback && self->count > 0)
+            {
+                self->selectCallback(self->selected, self->callbackContext);
+            }
+            break;
+
+        case LV_EVENT_DELETE:
+            // Screen destroyed: rows go with it, the list is inert until create()
+            lv_anim_delete(self->container, scrollAnimCb);
+            self->container = nullptr;
+            self->rowCount = 0;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+} // namespace CloudMouse::Hardware
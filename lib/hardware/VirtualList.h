@@ -0,0 +1,150 @@
+/**
+ * CloudMouse SDK - Virtualised LVGL List
+ *
+ * Scrolling list for large data sets (menus, WiFi scan results, logs). A list built
+ * from one LVGL object per entry allocates every row from the LVGL heap; VirtualList
+ * keeps only the rows in view plus VIRTUAL_LIST_PREFETCH_ROWS above and below as real
+ * label objects and rebinds them as the list scrolls, so memory is constant whether it
+ * shows ten items or ten thousand.
+ *
+ * How It Works:
+ * - Items are identified by index; the data source callback fills a row label for an
+ *   index whenever a row is (re)bound to it
+ * - Scrolling moves the row objects and recycles rows that left the window for the
+ *   newly exposed indices; rows that stay in view are never rebound
+ * - Selection follows the encoder: the list takes the encoder group focus in edit
+ *   mode, rotation moves the selection and scrolls it into view with a short
+ *   animation, a click reports the selected index
+ *
+ * Styling:
+ * - Rows use UiTheme LIST_ROW, the selected row LIST_ROW_SELECTED (checked state)
+ * - Row geometry is one style shared by all rows of the list
+ *
+ * Thread Safety:
+ * - UI task only; LVGL owns the objects, VirtualList detaches when they are deleted
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// Upper bound of row objects per list (visible rows + prefetch)
+#ifndef VIRTUAL_LIST_MAX_ROWS
+#define VIRTUAL_LIST_MAX_ROWS 16
+#endif
+
+// Rows bound ahead of the visible window on each side
+#ifndef VIRTUAL_LIST_PREFETCH_ROWS
+#define VIRTUAL_LIST_PREFETCH_ROWS 1
+#endif
+
+// Duration of the scroll animation towards the selection
+#ifndef VIRTUAL_LIST_SCROLL_MS
+#define VIRTUAL_LIST_SCROLL_MS 120
+#endif
+
+namespace CloudMouse::Hardware
+{
+    /**
+     * Fill a row for an item, typically with lv_label_set_text()
+     */
+    typedef void (*VirtualListBindCallback)(uint32_t index, lv_obj_t *label, void *context);
+
+    /**
+     * Item activated with an encoder click
+     */
+    typedef void (*VirtualListSelectCallback)(uint32_t index, void *context);
+
+    class VirtualList
+    {
+    public:
+        /**
+         * Create the list container and its row pool
+         *
+         * @param parent Parent object (usually a screen)
+         * @param width Width in pixels
+         * @param height Visible height in pixels
+         * @param rowHeight Height of one row in pixels
+         * @return Container object, nullptr if the row pool would exceed VIRTUAL_LIST_MAX_ROWS
+         */
+        lv_obj_t *create(lv_obj_t *parent, int32_t width, int32_t height, int32_t rowHeight);
+
+        /**
+         * Set the callbacks providing item contents and handling clicks
+         */
+        void setDataSource(VirtualListBindCallback bind, VirtualListSelectCallback select, void *context);
+
+        /**
+         * Set the number of items; rebinds visible rows and clamps the selection
+         */
+        void setCount(uint32_t count);
+        uint32_t getCount() const { return count; }
+
+        /**
+         * Select an item and scroll it into view
+         *
+         * @param index Item index (clamped to the item count)
+         * @param animate Animate the scroll instead of jumping
+         */
+        void setSelected(uint32_t index, bool animate = true);
+        uint32_t getSelected() const { return selected; }
+
+        /**
+         * Rebind all rows in the window (item contents changed)
+         */
+        void refresh();
+
+        /**
+         * Give the list the encoder focus in edit mode, so rotation reaches it as keys
+         */
+        void focus(lv_group_t *group);
+
+        lv_obj_t *getObject() const { return container; }
+
+        /**
+         * Row objects in the pool (constant for the lifetime of the list)
+         */
+        uint8_t getRowObjects() const { return rowCount; }
+
+        /**
+         * Data source calls since creation
+         */
+        uint32_t getBinds() const { return binds; }
+
+    private:
+        struct Row
+        {
+            lv_obj_t *label;
+            int32_t index; // Bound item, -1 when free
+        };
+
+        lv_obj_t *container = nullptr;
+        Row rows[VIRTUAL_LIST_MAX_ROWS] = {};
+        uint8_t rowCount = 0;
+        lv_style_t rowStyle;
+        bool rowStyleReady = false;
+
+        int32_t rowHeight = 0;
+        int32_t viewHeight = 0;
+        int32_t scrollY = 0;      // Current offset of the first row, in pixels
+        int32_t scrollTarget = 0; // Offset the running animation ends at
+
+        uint32_t count = 0;
+        uint32_t selected = 0;
+        uint32_t binds = 0;
+
+        VirtualListBindCallback bindCallback = nullptr;
+        VirtualListSelectCallback selectCallback = nullptr;
+        void *callbackContext = nullptr;
+
+        void layout();
+        void bindRow(Row &row, uint32_t index);
+        void scrollTo(int32_t y, bool animate);
+        int32_t maxScroll() const;
+
+        static void eventCb(lv_event_t *e);
+        static void scrollAnimCb(void *var, int32_t value);
+    };
+
+} // namespace CloudMouse::Hardware
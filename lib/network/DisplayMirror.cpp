@@ -0,0 +1,523 @@
+/**
+ * CloudMouse SDK - Live Display Mirror over WebSocket Implementation
+ */
+
+#include "./DisplayMirror.h"
+#include "./SocketSend.h"
+#include "./WebSocketHandshake.h"
+#include "../core/EventBus.h"
+
+namespace CloudMouse::Network
+{
+    using Hardware::CaptureSink;
+
+    namespace
+    {
+        const uint8_t WS_OPCODE_BINARY = 0x2;
+        const uint8_t WS_OPCODE_CLOSE = 0x8;
+        const uint8_t WS_OPCODE_PING = 0x9;
+        const uint8_t WS_OPCODE_PONG = 0xA;
+        const uint8_t WS_FIN = 0x80;
+
+        // Viewer: decodes the ScreenCapture packet format (see ScreenCapture.h) into a canvas
+        const char VIEWER_PAGE[] = R"rawliteral(<!DOCTYPE html>
+<html lang="en">
+<head>
+<meta charset="UTF-8">
+<title>CloudMouse - Display Mirror</title>
+<style>
+body { background: #111; color: #aaa; font-family: -apple-system, sans-serif; text-align: center; }
+canvas { margin-top: 24px; border: 1px solid #333; image-rendering: pixelated; width: 960px; }
+</style>
+</head>
+<body>
+<canvas id="screen" width="480" height="320"></canvas>
+<p id="status">connecting...</p>
+<script>
+const canvas = document.getElementById('screen'), ctx = canvas.getContext('2d');
+const status = document.getElementById('status');
+let records = null, lastSeq = -1, valid = false, frames = 0, bytes = 0;
+
+function band(d, p, x, y, w, h, swapped) {
+  const img = ctx.createImageData(w, h), out = img.data;
+  for (let i = 0; i < w * h;) {
+    const header = d[p] | d[p + 1] << 8, count = header & 0x7fff, repeat = header & 0x8000;
+    p += 2;
+    for (let k = 0; k < count; k++, i++) {
+      const q = repeat ? p : p + k * 2;
+      const v = swapped ? (d[q] << 8 | d[q + 1]) : (d[q] | d[q + 1] << 8);
+      out.set([(v >> 11 & 31) * 255 / 31, (v >> 5 & 63) * 255 / 63, (v & 31) * 255 / 31, 255], i * 4);
+    }
+    p += repeat ? 2 : count * 2;
+  }
+  ctx.putImageData(img, x, y);
+  return p;
+}
+
+function frame(d) {
+  if (d[0] != 70) return; // 'F'
+  const v = new DataView(d.buffer, d.byteOffset, d.length);
+  const w = v.getUint16(9, true), h = v.getUint16(11, true), flags = d[13];
+  if (flags & 1) {
+    valid = true;
+    if (canvas.width != w || canvas.height != h) { canvas.width = w; canvas.height = h; }
+  }
+  if (!valid) return; // Wait for a keyframe
+  for (let p = 14; p < d.length;) {
+    const kind = d[p++];
+    if (kind == 69) break; // 'E'
+    if (kind != 66) { valid = false; return; } // 'B'
+    p = band(d, p + 8, v.getUint16(p, true), v.getUint16(p + 2, true),
+             v.getUint16(p + 4, true), v.getUint16(p + 6, true), flags & 2);
+  }
+  frames++;
+}
+
+function packet(buffer) {
+  const d = new Uint8Array(buffer);
+  bytes += d.length;
+  if (d[0] != 67 || d[1] != 77 || d[2] != 67 || d[3] != 80) return; // "CMCP"
+  const flags = d[4], seq = d[5] | d[6] << 8, len = d[7] | d[8] << 8;
+  const inOrder = lastSeq >= 0 && seq == ((lastSeq + 1) & 0xffff);
+  lastSeq = seq;
+  if (flags & 1) { if (!inOrder) valid = false; records = []; }
+  else if (!records) return;
+  else if (!inOrder) { records = null; valid = false; return; }
+  records.push(d.subarray(9, 9 + len));
+  if (flags & 2) {
+    const all = new Uint8Array(records.reduce((n, a) => n + a.length, 0));
+    let o = 0;
+    for (const a of records) { all.set(a, o); o += a.length; }
+    records = null;
+    frame(all);
+  }
+}
+
+const ws = new WebSocket('ws://' + location.host + '/ws');
+ws.binaryType = 'arraybuffer';
+ws.onmessage = e => packet(e.data);
+ws.onclose = () => status.textContent = 'disconnected - reload to reconnect';
+setInterval(() => {
+  if (ws.readyState == 1) status.textContent = 'live: ' + frames + ' updates/s, ' + (bytes / 1024).toFixed(1) + ' KB/s';
+  frames = 0;
+  bytes = 0;
+}, 1000);
+</script>
+</body>
+</html>
+)rawliteral";
+
+        // Value of an HTTP header (case-insensitive name), copied into value
+        bool findHeader(const char *request, const char *name, char *value, size_t size)
+        {
+            const size_t nameLen = strlen(name);
+            for (const char *line = strstr(request, "\r\n"); line; line = strstr(line, "\r\n"))
+            {
+                line += 2;
+                if (strncasecmp(line, name, nameLen) != 0 || line[nameLen] != ':') continue;
+
+                const char *start = line + nameLen + 1;
+                while (*start == ' ') start++;
+                size_t len = strcspn(start, "\r\n");
+                if (len >= size) return false;
+                memcpy(value, start, len);
+                value[len] = '\0';
+                return true;
+            }
+            return false;
+        }
+    }
+
+    // ============================================================================
+    // LIFECYCLE
+    // ============================================================================
+
+    bool DisplayMirror::begin(Hardware::ScreenCapture *screenCapture, uint16_t listenPort)
+    {
+        if (running || !screenCapture) return false;
+
+        capture = screenCapture;
+        port = listenPort;
+        server.begin(port);
+        server.setNoDelay(true);
+        running = true;
+
+        Serial.printf("📺 Display mirror listening on port %u (viewer at http://<device-ip>:%u/)\n", port, port);
+        return true;
+    }
+
+    void DisplayMirror::stop()
+    {
+        if (!running) return;
+
+        if (state != State::IDLE) closeClient("mirror stopped");
+        server.end();
+        running = false;
+        Serial.println("📺 Display mirror stopped");
+    }
+
+    void DisplayMirror::update()
+    {
+        if (!running) return;
+
+        acceptClient();
+
+        switch (state)
+        {
+        case State::REQUEST:
+            readRequest();
+            break;
+
+        case State::RESPONDING:
+            flushResponse();
+            break;
+
+        case State::STREAMING:
+            readFrames();
+            if (state == State::STREAMING) pumpPackets();
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    void DisplayMirror::print() const
+    {
+        Serial.printf("📺 Mirror: %s, port %u, viewer %s, %lu viewers so far\n",
+                      running ? "running" : "stopped", port, hasViewer() ? "connected" : "none",
+                      (unsigned long)viewers);
+        Serial.printf("   %lu messages, %.1f KB sent, %lu stalled writes\n",
+                      (unsigned long)messagesSent, bytesSent / 1024.0f, (unsigned long)stalls);
+    }
+
+    // ============================================================================
+    // HTTP
+    // ============================================================================
+
+    void DisplayMirror::acceptClient()
+    {
+        // While a request is being read or answered, new connections wait in the listen backlog
+        if (state == State::REQUEST || state == State::RESPONDING) return;
+
+        WiFiClient incomingClient = server.available();
+        if (!incomingClient) return;
+
+        if (state == State::STREAMING)
+        {
+            static const char BUSY[] = "HTTP/1.1 503 Service Unavailable\r\nConnection: close\r\n"
+                                       "Content-Length: 23\r\n\r\nOne viewer at a time.\r\n";
+            // Fresh socket with an empty send buffer: the whole reply fits
+            sendNonBlocking(incomingClient, (const uint8_t *)BUSY, sizeof(BUSY) - 1);
+            incomingClient.stop();
+            return;
+        }
+
+        client = incomingClient;
+        state = State::REQUEST;
+        requestLen = 0;
+        connectedMs = millis();
+    }
+
+    void DisplayMirror::readRequest()
+    {
+        while (client.available() > 0 && requestLen < sizeof(request) - 1)
+        {
+            int bytes = client.read((uint8_t *)request + requestLen, sizeof(request) - 1 - requestLen);
+            if (bytes <= 0) break;
+            requestLen += bytes;
+        }
+        request[requestLen] = '\0';
+
+        if (strstr(request, "\r\n\r\n"))
+        {
+            handleRequest();
+        }
+        else if (requestLen >= sizeof(request) - 1 || millis() - connectedMs > MIRROR_HANDSHAKE_TIMEOUT_MS)
+        {
+            closeClient("incomplete request");
+        }
+        else if (!client.connected())
+        {
+            closeClient("client left");
+        }
+    }
+
+    void DisplayMirror::handleRequest()
+    {
+        if (strncmp(request, "GET ", 4) != 0)
+        {
+            sendHttp("405 Method Not Allowed", "text/plain", "GET only\r\n");
+            return;
+        }
+
+        const char *path = request + 4;
+        if (strncmp(path, "/ws ", 4) == 0)
+        {
+            char key[WEBSOCKET_KEY_MAX + 1];
+            if (!findHeader(request, "Sec-WebSocket-Key", key, sizeof(key)))
+            {
+                sendHttp("400 Bad Request", "text/plain", "WebSocket upgrade expected\r\n");
+                return;
+            }
+            if (!upgrade(key)) closeClient("upgrade failed");
+            return;
+        }
+
+        if (strncmp(path, "/ ", 2) == 0 || strncmp(path, "/index.html ", 12) == 0)
+        {
+            sendHttp("200 OK", "text/html", VIEWER_PAGE);
+            return;
+        }
+
+        sendHttp("404 Not Found", "text/plain", "Not found\r\n");
+    }
+
+    void DisplayMirror::sendHttp(const char *status, const char *contentType, const char *body)
+    {
+        // Header goes through the message buffer, the body (static text) is sent in place
+        const size_t bodyLen = strlen(body);
+        int len = snprintf((char *)message, sizeof(message),
+                           "HTTP/1.1 %s\r\nContent-Type: %s\r\nContent-Length: %u\r\nConnection: close\r\n\r\n",
+                           status, contentType, (unsigned)bodyLen);
+
+        messageLen = (size_t)len;
+        messageSent = 0;
+        responseBody = (const uint8_t *)body;
+        responseLen = bodyLen;
+        responseSent = 0;
+        state = State::RESPONDING;
+        connectedMs = millis();
+        flushResponse();
+    }
+
+    void DisplayMirror::flushResponse()
+    {
+        // The viewer page is larger than the lwIP send buffer: finish it over several updates
+        if (messageSent < messageLen)
+        {
+            messageSent += sendNonBlocking(client, message + messageSent, messageLen - messageSent);
+        }
+        if (messageSent == messageLen && responseSent < responseLen)
+        {
+            responseSent += sendNonBlocking(client, responseBody + responseSent, responseLen - responseSent);
+        }
+
+        if (messageSent == messageLen && responseSent == responseLen)
+        {
+            closeClient(nullptr);
+        }
+        else if (millis() - connectedMs > MIRROR_HANDSHAKE_TIMEOUT_MS)
+        {
+            closeClient("response timed out");
+        }
+        else if (!client.connected())
+        {
+            closeClient("client left");
+        }
+    }
+
+    bool DisplayMirror::upgrade(const char *key)
+    {
+        char accept[WEBSOCKET_ACCEPT_SIZE];
+        if (!WebSocket::acceptKey(key, accept, sizeof(accept))) return false;
+
+        char response[160];
+        int len = snprintf(response, sizeof(response),
+                           "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\n"
+                           "Connection: Upgrade\r\nSec-WebSocket-Accept: %s\r\n\r\n",
+                           accept);
+
+        // Request fully read and nothing sent yet, so the send buffer is empty
+        if (sendNonBlocking(client, (const uint8_t *)response, len) != (size_t)len) return false;
+
+        state = State::STREAMING;
+        viewers++;
+        messageLen = messageSent = 0;
+        incomingLen = 0;
+        setStreaming(true);
+
+        Serial.printf("📺 Mirror viewer connected (#%lu)\n", (unsigned long)viewers);
+        return true;
+    }
+
+    void DisplayMirror::closeClient(const char *reason)
+    {
+        if (state == State::STREAMING)
+        {
+            setStreaming(false);
+            Serial.printf("📺 Mirror viewer disconnected: %s\n", reason ? reason : "closed");
+        }
+        else if (reason)
+        {
+            Serial.printf("📺 Mirror connection dropped: %s\n", reason);
+        }
+
+        client.stop();
+        state = State::IDLE;
+        requestLen = 0;
+        messageLen = messageSent = 0;
+        responseLen = responseSent = 0;
+    }
+
+    void DisplayMirror::setStreaming(bool enabled)
+    {
+        if (enabled)
+        {
+            // Packets queued for another sink would precede the keyframe
+            uint8_t *scratch = message;
+            while (capture->readPacket(scratch, sizeof(message)) > 0)
+            {
+            }
+
+            Event start(EventType::DISPLAY_CAPTURE, MIRROR_FPS);
+            start.setStringData("ws");
+            EventBus::instance().sendToUI(start);
+        }
+        else if (capture->getSink() == CaptureSink::WEBSOCKET)
+        {
+            EventBus::instance().sendToUI(Event(EventType::DISPLAY_CAPTURE, -1));
+        }
+    }
+
+    // ============================================================================
+    // WEBSOCKET
+    // ============================================================================
+
+    void DisplayMirror::readFrames()
+    {
+        if (!client.connected())
+        {
+            closeClient("connection lost");
+            return;
+        }
+
+        while (client.available() > 0 && incomingLen < sizeof(incoming))
+        {
+            int bytes = client.read(incoming + incomingLen, sizeof(incoming) - incomingLen);
+            if (bytes <= 0) break;
+            incomingLen += bytes;
+        }
+
+        // Viewer frames are small control frames; anything larger is not expected
+        while (incomingLen >= 2)
+        {
+            const uint8_t opcode = incoming[0] & 0x0F;
+            const bool masked = incoming[1] & 0x80;
+            size_t payloadLen = incoming[1] & 0x7F;
+            size_t headerLen = 2;
+
+            if (payloadLen == 126)
+            {
+                if (incomingLen < 4) return;
+                payloadLen = (incoming[2] << 8) | incoming[3];
+                headerLen = 4;
+            }
+            else if (payloadLen == 127)
+            {
+                closeClient("oversized client message");
+                return;
+            }
+
+            const size_t frameLen = headerLen + (masked ? 4 : 0) + payloadLen;
+            if (frameLen > sizeof(incoming))
+            {
+                closeClient("oversized client message");
+                return;
+            }
+            if (incomingLen < frameLen) return;
+
+            uint8_t *payload = incoming + headerLen + (masked ? 4 : 0);
+            if (masked)
+            {
+                const uint8_t *mask = incoming + headerLen;
+                for (size_t i = 0; i < payloadLen; i++) payload[i] ^= mask[i % 4];
+            }
+
+            if (opcode == WS_OPCODE_CLOSE)
+            {
+                sendControl(WS_OPCODE_CLOSE, payload, payloadLen < 2 ? payloadLen : 2);
+                if (state == State::STREAMING) closeClient("closed by viewer");
+                return;
+            }
+            if (opcode == WS_OPCODE_PING)
+            {
+                sendControl(WS_OPCODE_PONG, payload, payloadLen);
+            }
+
+            memmove(incoming, incoming + frameLen, incomingLen - frameLen);
+            incomingLen -= frameLen;
+        }
+    }
+
+    void DisplayMirror::pumpPackets()
+    {
+        size_t written = 0;
+        while (written < MIRROR_BYTES_PER_UPDATE)
+        {
+            if (messageSent == messageLen)
+            {
+                // Packets meant for another sink (serial/HTTP screenshot) are not ours to drain
+                if (capture->getSink() != CaptureSink::WEBSOCKET) return;
+
+                // Packet goes in behind the largest header; short packets start later
+                const size_t bytes = capture->readPacket(message + 4, sizeof(message) - 4);
+                if (bytes == 0) return;
+
+                if (bytes < 126)
+                {
+                    message[2] = WS_FIN | WS_OPCODE_BINARY;
+                    message[3] = (uint8_t)bytes;
+                    messageSent = 2;
+                }
+                else
+                {
+                    message[0] = WS_FIN | WS_OPCODE_BINARY;
+                    message[1] = 126;
+                    message[2] = (uint8_t)(bytes >> 8);
+                    message[3] = (uint8_t)bytes;
+                    messageSent = 0;
+                }
+                messageLen = 4 + bytes;
+            }
+
+            const size_t before = messageSent;
+            const bool done = flushMessage();
+            written += messageSent - before;
+            if (!done) return; // Viewer lags: continue next update, capture ring absorbs the rest
+        }
+    }
+
+    bool DisplayMirror::flushMessage()
+    {
+        const size_t bytes = sendNonBlocking(client, message + messageSent, messageLen - messageSent);
+        messageSent += bytes;
+        bytesSent += bytes;
+
+        if (messageSent == messageLen)
+        {
+            messagesSent++;
+            return true;
+        }
+
+        stalls++;
+        if (!client.connected()) closeClient("write failed");
+        return false;
+    }
+
+    void DisplayMirror::sendControl(uint8_t opcode, const uint8_t *payload, size_t len)
+    {
+        // Never inside a half-written data message; a skipped pong is harmless
+        if (messageSent != messageLen || len > 125) return;
+
+        // Sent like a data message, so a partial write is finished by pumpPackets()
+        // instead of corrupting the stream
+        message[0] = WS_FIN | opcode;
+        message[1] = (uint8_t)len;
+        memmove(message + 2, payload, len);
+        messageLen = 2 + len;
+        messageSent = 0;
+        flushMessage();
+    }
+
+} // namespace CloudMouse::Network
@@ -0,0 +1,138 @@
+/**
+ * CloudMouse SDK - Live Display Mirror over WebSocket
+ *
+ * Streams the device screen to a browser for support and demos. Pixels come from
+ * the ScreenCapture stream (WEBSOCKET sink): a keyframe when the viewer connects,
+ * then only the bands LVGL redrew, run-length encoded and capped at MIRROR_FPS.
+ * Bandwidth follows the amount of change on screen, not the frame rate.
+ *
+ * Endpoints (port MIRROR_PORT, independent of the setup portal):
+ * - GET /      Viewer page: canvas + JavaScript decoder of the capture packets
+ * - GET /ws    WebSocket; every capture packet is sent as one binary message
+ *
+ * Back-pressure:
+ * - Every write goes through sendNonBlocking() (SocketSend.h), so a slow viewer never
+ *   blocks the coordination loop
+ * - A partially sent message is finished on the next update() before anything else
+ *   is read; the viewer page is sent the same way over as many updates as it takes
+ * - While the viewer lags, packets stay in the capture ring; once it is full the
+ *   capture drops whole frames and resumes with a keyframe (see ScreenCapture)
+ *
+ * Limits:
+ * - One viewer at a time; further WebSocket requests get 503 until it disconnects
+ * - Client messages are only parsed for ping and close
+ * - Handshake key hashing in WebSocketHandshake (mbedTLS on device)
+ *
+ * Host Builds:
+ * - WiFiServer/WiFiClient come from the POSIX socket shim, so the headless runner
+ *   can serve the viewer on localhost ("mirror" script command)
+ *
+ * Thread Safety:
+ * - One task (Core 0 coordination loop, or the host runner)
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include "../hardware/ScreenCapture.h"
+
+#ifndef MIRROR_PORT
+#define MIRROR_PORT 81
+#endif
+
+// Upper bound for the mirror stream; the capture only sends frames that changed
+#ifndef MIRROR_FPS
+#define MIRROR_FPS 10
+#endif
+
+// Bytes written per update() so a fast viewer cannot starve the coordination loop
+#ifndef MIRROR_BYTES_PER_UPDATE
+#define MIRROR_BYTES_PER_UPDATE (32 * 1024)
+#endif
+
+// Time a new connection has to send its HTTP request
+#define MIRROR_HANDSHAKE_TIMEOUT_MS 2000
+
+namespace CloudMouse::Network
+{
+    class DisplayMirror
+    {
+    public:
+        /**
+         * Start listening for viewers
+         *
+         * @param capture DisplayManager capture to stream (WEBSOCKET sink)
+         * @param port TCP port of the viewer page and WebSocket
+         * @return false if already running or no capture is given
+         */
+        bool begin(Hardware::ScreenCapture *capture, uint16_t port = MIRROR_PORT);
+        void stop();
+
+        /**
+         * Accept and upgrade connections, pump capture packets to the viewer
+         * Call regularly (every coordination cycle)
+         */
+        void update();
+
+        bool isRunning() const { return running; }
+        bool hasViewer() const { return state == State::STREAMING; }
+        void print() const;
+
+    private:
+        enum class State : uint8_t
+        {
+            IDLE,      // No client
+            REQUEST,    // Reading the HTTP request
+            RESPONDING, // Sending a plain HTTP response, then closing
+            STREAMING   // WebSocket open
+        };
+
+        WiFiServer server;
+        WiFiClient client;
+        Hardware::ScreenCapture *capture = nullptr;
+        bool running = false;
+        uint16_t port = MIRROR_PORT;
+        State state = State::IDLE;
+
+        // HTTP request of the current connection
+        char request[768];
+        size_t requestLen = 0;
+        uint32_t connectedMs = 0;
+
+        // WebSocket message being written (header + capture packet), or the
+        // header of a plain HTTP response
+        uint8_t message[CAPTURE_PACKET_MAX_BYTES + 4];
+        size_t messageLen = 0;
+        size_t messageSent = 0;
+
+        // Body of a plain HTTP response (static text)
+        const uint8_t *responseBody = nullptr;
+        size_t responseLen = 0;
+        size_t responseSent = 0;
+
+        // Client frames (ping / close)
+        uint8_t incoming[128];
+        size_t incomingLen = 0;
+
+        // Statistics
+        uint32_t viewers = 0;
+        uint32_t messagesSent = 0;
+        uint64_t bytesSent = 0;
+        uint32_t stalls = 0;
+
+        void acceptClient();
+        void readRequest();
+        void handleRequest();
+        void sendHttp(const char *status, const char *contentType, const char *body);
+        void flushResponse();
+        bool upgrade(const char *key);
+        void readFrames();
+        void pumpPackets();
+        bool flushMessage();
+        void sendControl(uint8_t opcode, const uint8_t *payload, size_t len);
+        void closeClient(const char *reason);
+        void setStreaming(bool enabled);
+    };
+
+} // namespace CloudMouse::Network
@@ -0,0 +1,45 @@
+/**
+ * CloudMouse SDK - Non-Blocking Socket Writes
+ *
+ * WiFiClient::write() on ESP32 retries with select() until everything is queued,
+ * which holds the calling loop for as long as the peer's TCP window stays full.
+ * sendNonBlocking() queues only what the lwIP send buffer takes right now; callers
+ * keep the remainder and retry on their next update.
+ *
+ * Used by the display mirror and the "/capture" endpoint.
+ *
+ * Host Builds:
+ * - The WiFi shim's sockets are non-blocking already, write() is used as is
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#ifndef CLOUDMOUSE_HOST_BUILD
+#include <lwip/sockets.h>
+#endif
+
+namespace CloudMouse::Network
+{
+    /**
+     * Queue as much of data as the socket accepts without waiting
+     *
+     * @return Bytes queued; 0 when the buffer is full or on error
+     *         (client.connected() tells them apart)
+     */
+    inline size_t sendNonBlocking(WiFiClient &client, const uint8_t *data, size_t len)
+    {
+#ifdef CLOUDMOUSE_HOST_BUILD
+        return client.write(data, len);
+#else
+        const int fd = client.fd();
+        if (fd < 0 || len == 0) return 0;
+
+        const ssize_t sent = send(fd, data, len, MSG_DONTWAIT);
+        return sent > 0 ? (size_t)sent : 0;
+#endif
+    }
+
+} // namespace CloudMouse::Network
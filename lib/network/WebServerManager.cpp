@@ -6,13 +6,18 @@
  */
 
 #include "./WebServerManager.h"
+#include "./SocketSend.h"
 #include "../prefs/PreferencesManager.h"
+#include "../core/EventBus.h"
 
 namespace CloudMouse::Network
 {
     // Static instance pointer for callback system
     WebServerManager *WebServerManager::instance = nullptr;
 
+    // One screenshot packet on its way to the "/capture" client
+    static uint8_t capturePacket[CAPTURE_PACKET_MAX_BYTES];
+
     WebServerManager::WebServerManager(WiFiManager &wifiMgr)
         : webServer(80), wifiManager(wifiMgr)
     {
@@ -30,6 +35,7 @@ namespace CloudMouse::Network
         // Register HTTP route handlers
         webServer.on("/", handleRoot);                    // Main configuration page
         webServer.on("/config", HTTP_POST, handleConfig); // Credential submission endpoint
+        webServer.on("/capture", HTTP_GET, handleCapture); // Screenshot packet stream
         webServer.onNotFound(handleNotFound);             // 404 handler for undefined routes
 
         // Start HTTP server on port 80
@@ -44,11 +50,34 @@ namespace CloudMouse::Network
     {
         // Process incoming HTTP requests (non-blocking)
         // Should be called regularly in main loop
-        webServer.handleClient();
+        if (serverRunning) webServer.handleClient();
+
+        pumpCapture();
+        mirror.update();
+    }
+
+    bool WebServerManager::startMirror()
+    {
+        if (!screenCapture)
+        {
+            Serial.println("❌ Display mirror needs a screen capture");
+            return false;
+        }
+        return mirror.begin(screenCapture);
+    }
+
+    void WebServerManager::stopMirror()
+    {
+        mirror.stop();
     }
 
     void WebServerManager::stop()
     {
+        if (capturePending)
+        {
+            captureClient.stop();
+            capturePending = false;
+        }
         webServer.stop();
         serverRunning = false;
         Serial.println("🌐 WebServer stopped");
@@ -312,6 +341,96 @@ namespace CloudMouse::Network
         }
     }
 
+    void WebServerManager::handleCapture()
+    {
+        if (!instance)
+            return;
+
+        Hardware::ScreenCapture *capture = instance->screenCapture;
+        if (!capture)
+        {
+            instance->webServer.send(503, "text/plain", "Screen capture unavailable");
+            return;
+        }
+
+        if (instance->capturePending)
+        {
+            instance->webServer.send(503, "text/plain", "Capture in progress");
+            return;
+        }
+
+        // The capture has a single sink; switching it would cut the mirror's stream
+        if (instance->mirror.hasViewer())
+        {
+            instance->webServer.send(503, "text/plain", "Display mirror is streaming");
+            return;
+        }
+
+        // Leftovers of an earlier capture would precede the new frame
+        while (capture->readPacket(capturePacket, sizeof(capturePacket)) > 0)
+        {
+        }
+
+        Event request(EventType::DISPLAY_CAPTURE, 0);
+        request.setStringData("http");
+        EventBus::instance().sendToUI(request);
+
+        // Respond on a copy of the client so it outlives this handler; the body is
+        // delimited by closing the connection, no chunked framing needed
+        instance->captureClient = instance->webServer.client();
+        instance->captureLen = snprintf((char *)capturePacket, sizeof(capturePacket),
+                                        "HTTP/1.1 200 OK\r\n"
+                                        "Content-Type: application/octet-stream\r\n"
+                                        "Cache-Control: no-store\r\n"
+                                        "Connection: close\r\n\r\n");
+        instance->captureSent = 0;
+        instance->captureEnded = false;
+        instance->capturePending = true;
+        instance->captureStartMs = millis();
+        instance->pumpCapture();
+    }
+
+    void WebServerManager::pumpCapture()
+    {
+        if (!capturePending)
+            return;
+
+        const uint32_t elapsed = millis() - captureStartMs;
+        bool complete = false;
+        bool failed = !captureClient.connected();
+
+        // A few packets per call, so the loop keeps serving requests and the mirror;
+        // a packet the socket only partly took is finished first on the next call
+        for (int i = 0; i < CAPTURE_HTTP_PACKETS_PER_UPDATE && !failed; i++)
+        {
+            if (captureSent == captureLen)
+            {
+                if (captureEnded)
+                    break;
+
+                captureLen = screenCapture->readPacket(capturePacket, sizeof(capturePacket));
+                captureSent = 0;
+                if (captureLen == 0)
+                    break;
+                captureEnded = Hardware::ScreenCapture::endsFrame(capturePacket, captureLen);
+            }
+
+            captureSent += sendNonBlocking(captureClient, capturePacket + captureSent, captureLen - captureSent);
+            if (captureSent < captureLen)
+                break; // Client window full
+        }
+        if (captureEnded && captureSent == captureLen)
+            complete = true;
+
+        if (!complete && !failed && elapsed < CAPTURE_HTTP_TIMEOUT_MS)
+            return;
+
+        captureClient.stop();
+        capturePending = false;
+        Serial.printf("🌐 /capture %s after %lu ms\n",
+                      complete ? "sent" : (failed ? "aborted" : "timed out"), (unsigned long)elapsed);
+    }
+
     void WebServerManager::handleNotFound()
     {
         if (!instance)
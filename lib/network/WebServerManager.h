@@ -10,6 +10,9 @@
  * - Form-based credential collection with validation
  * - Integration with WiFiManager for connection handling
  * - Static file serving and error handling
+ * - Screenshot endpoint "/capture" (ScreenCapture packet stream, see
+ *   tools/capture/decode_capture.py)
+ * - Live display mirror on MIRROR_PORT (DisplayMirror), also in station mode
  *
  * Usage:
  * 1. Initialize after setting up Access Point mode
@@ -22,6 +25,18 @@
 #include <WebServer.h>
 #include <WiFi.h>
 #include "WiFiManager.h"
+#include "./DisplayMirror.h"
+#include "../hardware/ScreenCapture.h"
+
+// How long "/capture" waits for the UI task to render and encode the screenshot
+#ifndef CAPTURE_HTTP_TIMEOUT_MS
+#define CAPTURE_HTTP_TIMEOUT_MS 3000
+#endif
+
+// Capture packets forwarded to the "/capture" client per update() call
+#ifndef CAPTURE_HTTP_PACKETS_PER_UPDATE
+#define CAPTURE_HTTP_PACKETS_PER_UPDATE 4
+#endif
 
 namespace CloudMouse::Network
 {
@@ -44,8 +59,9 @@ namespace CloudMouse::Network
         void init();
 
         /**
-         * Process incoming HTTP requests
-         * Should be called regularly in main loop when AP mode is active
+         * Process incoming HTTP requests, pump a pending "/capture" response and the
+         * display mirror
+         * Should be called regularly in main loop when AP mode or the mirror is active
          */
         void update();
 
@@ -68,11 +84,40 @@ namespace CloudMouse::Network
          */
         void refreshNetworks() { scanNetworks(); }
 
+        /**
+         * Enable the "/capture" screenshot endpoint
+         *
+         * @param capture DisplayManager capture whose packets the endpoint drains
+         */
+        void setScreenCapture(Hardware::ScreenCapture *capture) { screenCapture = capture; }
+
+        /**
+         * Start the live display mirror (viewer page + WebSocket on MIRROR_PORT)
+         * Works in AP and station mode; needs setScreenCapture() first
+         *
+         * @return false without a screen capture or if already running
+         */
+        bool startMirror();
+        void stopMirror();
+        bool isMirrorRunning() const { return mirror.isRunning(); }
+        bool hasMirrorViewer() const { return mirror.hasViewer(); } // Capture is streaming to the mirror
+        void printMirror() const { mirror.print(); }
+
     private:
         WebServer webServer;        // ESP32 web server instance (port 80)
         WiFiManager &wifiManager;   // Reference to WiFi connection manager
         String networkList;         // HTML options list of scanned networks
         bool serverRunning = false; // Server status flag
+        Hardware::ScreenCapture *screenCapture = nullptr;
+        DisplayMirror mirror;       // Live display viewer (own port)
+
+        // "/capture" response in progress, fed from update()
+        WiFiClient captureClient;
+        bool capturePending = false;
+        uint32_t captureStartMs = 0;
+        size_t captureLen = 0;  // Bytes in capturePacket (headers or one packet)
+        size_t captureSent = 0; // Of those, already queued on the socket
+        bool captureEnded = false; // capturePacket holds the frame's last packet
 
         // Static instance pointer for callback handlers
         static WebServerManager *instance;
@@ -93,6 +138,13 @@ namespace CloudMouse::Network
          */
         String generateConfigPage();
 
+        /**
+         * Forward screenshot packets to the pending "/capture" client
+         * Closes the response once the frame is complete, the client is gone or
+         * CAPTURE_HTTP_TIMEOUT_MS has passed
+         */
+        void pumpCapture();
+
         // Static HTTP request handlers (required for WebServer callback system)
 
         /**
@@ -109,6 +161,14 @@ namespace CloudMouse::Network
          */
         static void handleConfig();
 
+        /**
+         * Handle GET requests to "/capture"
+         * Requests a screenshot from the UI task, sends the response headers and
+         * returns; update() streams the packets as they are encoded and closes the
+         * connection at the end of the frame (application/octet-stream, no length)
+         */
+        static void handleCapture();
+
         /**
          * Handle requests to undefined routes
          * Returns 404 error response
@@ -0,0 +1,122 @@
+/**
+ * CloudMouse SDK - WebSocket Opening Handshake Implementation
+ */
+
+#include "./WebSocketHandshake.h"
+
+#ifndef CLOUDMOUSE_HOST_BUILD
+#include <esp_idf_version.h>
+#include <mbedtls/base64.h>
+#include <mbedtls/sha1.h>
+#endif
+
+namespace CloudMouse::Network::WebSocket
+{
+    namespace
+    {
+        const char *GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+#ifdef CLOUDMOUSE_HOST_BUILD
+        // ========================================================================
+        // PORTABLE SHA-1 / BASE64 (host builds have no mbedTLS)
+        // ========================================================================
+
+        uint32_t rotl(uint32_t value, int bits)
+        {
+            return (value << bits) | (value >> (32 - bits));
+        }
+
+        void sha1(const uint8_t *data, size_t len, uint8_t digest[20])
+        {
+            uint32_t h[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+            const uint64_t bitLen = (uint64_t)len * 8;
+            const size_t total = ((len + 8) / 64 + 1) * 64;
+
+            for (size_t chunk = 0; chunk < total; chunk += 64)
+            {
+                uint32_t w[80];
+                for (int i = 0; i < 16; i++)
+                {
+                    uint32_t word = 0;
+                    for (int b = 0; b < 4; b++)
+                    {
+                        const size_t pos = chunk + i * 4 + b;
+                        uint8_t byte;
+                        if (pos < len) byte = data[pos];
+                        else if (pos == len) byte = 0x80;
+                        else if (pos >= total - 8) byte = (uint8_t)(bitLen >> ((total - 1 - pos) * 8));
+                        else byte = 0;
+                        word = (word << 8) | byte;
+                    }
+                    w[i] = word;
+                }
+                for (int i = 16; i < 80; i++) w[i] = rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+                uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+                for (int i = 0; i < 80; i++)
+                {
+                    uint32_t f, k;
+                    if (i < 20) f = (b & c) | (~b & d), k = 0x5A827999;
+                    else if (i < 40) f = b ^ c ^ d, k = 0x6ED9EBA1;
+                    else if (i < 60) f = (b & c) | (b & d) | (c & d), k = 0x8F1BBCDC;
+                    else f = b ^ c ^ d, k = 0xCA62C1D6;
+
+                    const uint32_t temp = rotl(a, 5) + f + e + k + w[i];
+                    e = d;
+                    d = c;
+                    c = rotl(b, 30);
+                    b = a;
+                    a = temp;
+                }
+                h[0] += a;
+                h[1] += b;
+                h[2] += c;
+                h[3] += d;
+                h[4] += e;
+            }
+
+            for (int i = 0; i < 20; i++) digest[i] = (uint8_t)(h[i / 4] >> (24 - (i % 4) * 8));
+        }
+
+        void base64(const uint8_t *data, size_t len, char *out)
+        {
+            static const char TABLE[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+            size_t o = 0;
+            for (size_t i = 0; i < len; i += 3)
+            {
+                const uint32_t n = (data[i] << 16) | ((i + 1 < len ? data[i + 1] : 0) << 8) | (i + 2 < len ? data[i + 2] : 0);
+                out[o++] = TABLE[(n >> 18) & 63];
+                out[o++] = TABLE[(n >> 12) & 63];
+                out[o++] = i + 1 < len ? TABLE[(n >> 6) & 63] : '=';
+                out[o++] = i + 2 < len ? TABLE[n & 63] : '=';
+            }
+            out[o] = '\0';
+        }
+#endif
+    }
+
+    bool acceptKey(const char *key, char *accept, size_t size)
+    {
+        const size_t keyLen = key ? strlen(key) : 0;
+        if (keyLen == 0 || keyLen > WEBSOCKET_KEY_MAX || size < WEBSOCKET_ACCEPT_SIZE) return false;
+
+        char source[WEBSOCKET_KEY_MAX + 37];
+        const size_t sourceLen = (size_t)snprintf(source, sizeof(source), "%s%s", key, GUID);
+
+        uint8_t digest[20];
+#ifdef CLOUDMOUSE_HOST_BUILD
+        sha1((const uint8_t *)source, sourceLen, digest);
+        base64(digest, sizeof(digest), accept);
+        return true;
+#else
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+        if (mbedtls_sha1((const unsigned char *)source, sourceLen, digest) != 0) return false;
+#else
+        if (mbedtls_sha1_ret((const unsigned char *)source, sourceLen, digest) != 0) return false;
+#endif
+        size_t written = 0;
+        return mbedtls_base64_encode((unsigned char *)accept, size, &written, digest, sizeof(digest)) == 0;
+#endif
+    }
+
+} // namespace CloudMouse::Network::WebSocket
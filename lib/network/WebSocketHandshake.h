@@ -0,0 +1,35 @@
+/**
+ * CloudMouse SDK - WebSocket Opening Handshake
+ *
+ * Sec-WebSocket-Accept derivation from RFC 6455 section 4.2.2: base64 of the SHA-1
+ * of the client's Sec-WebSocket-Key followed by the protocol GUID.
+ *
+ * Implementations:
+ * - Device: mbedTLS (mbedtls_sha1 / mbedtls_base64_encode) from ESP-IDF
+ * - Host builds: portable SHA-1 and base64, covered by tools/host/tests/websocket_tests.cpp
+ *   against the RFC 6455 example and padding-boundary vectors
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+// Longest Sec-WebSocket-Key accepted (browsers send 24 characters)
+#define WEBSOCKET_KEY_MAX 60
+
+// Size of an accept value including the terminator (28 base64 characters)
+#define WEBSOCKET_ACCEPT_SIZE 29
+
+namespace CloudMouse::Network::WebSocket
+{
+    /**
+     * Compute the Sec-WebSocket-Accept value for a client key
+     *
+     * @param key Sec-WebSocket-Key header value
+     * @param accept Output, at least WEBSOCKET_ACCEPT_SIZE bytes
+     * @param size Size of accept
+     * @return false if the key is empty or longer than WEBSOCKET_KEY_MAX, or accept is too small
+     */
+    bool acceptKey(const char *key, char *accept, size_t size);
+
+} // namespace CloudMouse::Network::WebSocket
@@ -0,0 +1,56 @@
+/**
+ * CloudMouse SDK - Monotonic Time Base
+ *
+ * Single clock for UI timing: LVGL reads it through lv_tick_set_cb() and the LED
+ * animations, display dimmer and encoder press/velocity math use the same source,
+ * so animation durations agree everywhere and no periodic tick ISR is needed.
+ *
+ * Sources:
+ * - Device: esp_timer_get_time(), 64-bit microseconds since boot (never wraps)
+ * - Host builds: HostClock virtual time advanced by the runner, so LVGL animations,
+ *   fades and timeouts are deterministic in scripted runs
+ *
+ * micros() stays in use for profiling (render/flush/latency figures), which should
+ * measure real CPU time on the host as well.
+ *
+ * Thread Safety:
+ * - All functions are lock-free and callable from any task or esp_timer callback
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#ifndef CLOUDMOUSE_HOST_BUILD
+#include <esp_timer.h>
+#endif
+
+namespace CloudMouse::Utils
+{
+    class Clock
+    {
+    public:
+        /**
+         * Microseconds since boot (virtual on host builds)
+         */
+        static int64_t nowUs()
+        {
+#ifdef CLOUDMOUSE_HOST_BUILD
+            return (int64_t)HostClock::now() * 1000;
+#else
+            return esp_timer_get_time();
+#endif
+        }
+
+        /**
+         * Milliseconds since boot, wraps after 49 days (compare with unsigned subtraction)
+         */
+        static uint32_t nowMs() { return (uint32_t)(nowUs() / 1000); }
+
+        /**
+         * LVGL tick source, for lv_tick_set_cb()
+         */
+        static uint32_t lvglTick() { return nowMs(); }
+    };
+
+} // namespace CloudMouse::Utils
@@ -0,0 +1,70 @@
+/**
+ * CloudMouse SDK - Scaled QR Code Blitter
+ *
+ * Expands a bit-packed QR module matrix straight into scaled RGB565 pixels. Drawing a
+ * symbol module by module costs one clipped fillRect per module (1681 calls for a
+ * version 6 code); the blitter instead produces one pixel row per module row and
+ * replicates it for the remaining scale rows, so callers push whole scanline bands.
+ *
+ * This module provides:
+ * - expandRow(): one module row -> size * scale pixels
+ * - blit(): whole symbol into an RGB565 buffer (rows replicated with memcpy)
+ * - blitReference(): per-module rectangle fill, equivalent to the sprite fillRect path
+ * - runBenchmark(): compares both paths and checks that their output is identical
+ *
+ * Colours are native RGB565; callers pass them through as lgfx::rgb565_t.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include "QRMatrix.h"
+
+namespace CloudMouse::Utils
+{
+    class QRBlitter
+    {
+    public:
+        /**
+         * Expand one module row into matrix.size * scale pixels
+         *
+         * @param dst Destination pixels
+         * @param matrix Encoded symbol
+         * @param y Module row
+         * @param scale Pixels per module (>= 1)
+         * @param fg Dark module colour
+         * @param bg Light module colour
+         */
+        static void expandRow(uint16_t *dst, const QRMatrix &matrix, uint8_t y, uint8_t scale, uint16_t fg, uint16_t bg);
+
+        /**
+         * Render the whole symbol at (0, 0) of an RGB565 buffer
+         *
+         * @param dst Destination, at least stride * size * scale pixels
+         * @param stride Destination row length in pixels
+         */
+        static void blit(uint16_t *dst, int32_t stride, const QRMatrix &matrix, uint8_t scale, uint16_t fg, uint16_t bg);
+
+        /**
+         * Reference path: one clipped rectangle fill per module
+         *
+         * @param width Buffer width in pixels (clip)
+         * @param height Buffer height in pixels (clip)
+         */
+        static void blitReference(uint16_t *dst, int32_t width, int32_t height, const QRMatrix &matrix,
+                                  uint8_t scale, uint16_t fg, uint16_t bg);
+
+        /**
+         * Time blitReference() against blit() and print results to Serial
+         *
+         * @return true if both paths produced identical pixels
+         */
+        static bool runBenchmark(const QRMatrix &matrix, uint8_t scale, int iterations);
+
+        /**
+         * Rendered symbol width/height in pixels
+         */
+        static constexpr int32_t pixelSize(const QRMatrix &matrix, uint8_t scale) { return (int32_t)matrix.size * scale; }
+    };
+
+} // namespace CloudMouse::Utils
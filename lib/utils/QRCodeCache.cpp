@@ -0,0 +1,275 @@
+/**
+ * CloudMouse SDK - Content-Keyed QR Code Cache Implementation
+ */
+
+#include "./QRCodeCache.h"
+#include <esp_heap_caps.h>
+
+namespace CloudMouse::Utils
+{
+    namespace
+    {
+        // Byte-mode capacity per version at low error correction (versions 1-10)
+        const uint16_t BYTE_CAPACITY_ECC_LOW[QR_CACHE_MAX_VERSION] = {17, 32, 53, 78, 106, 134, 154, 192, 230, 271};
+    }
+
+    QRCodeCache::~QRCodeCache()
+    {
+        clear();
+    }
+
+    // ============================================================================
+    // KEYING
+    // ============================================================================
+
+    uint32_t QRCodeCache::hash(const char *content)
+    {
+        uint32_t h = 2166136261u; // FNV-1a
+        while (*content)
+        {
+            h ^= (uint8_t)*content++;
+            h *= 16777619u;
+        }
+        return h;
+    }
+
+    uint8_t QRCodeCache::versionFor(size_t length)
+    {
+        for (uint8_t v = 1; v <= QR_CACHE_MAX_VERSION; v++)
+        {
+            if (length <= BYTE_CAPACITY_ECC_LOW[v - 1]) return v;
+        }
+        return 0;
+    }
+
+    QRCodeCache::Entry *QRCodeCache::find(const char *content, uint32_t h)
+    {
+        for (Entry &e : entries)
+        {
+            if (e.content[0] && e.hash == h && strcmp(e.content, content) == 0)
+            {
+                return &e;
+            }
+        }
+        return nullptr;
+    }
+
+    QRCodeCache::Entry *QRCodeCache::allocateEntry()
+    {
+        Entry *victim = &entries[0];
+        for (Entry &e : entries)
+        {
+            if (!e.content[0])
+            {
+                victim = &e;
+                break;
+            }
+            if ((int32_t)(e.lastUsedMs - victim->lastUsedMs) < 0) victim = &e;
+        }
+
+        heap_caps_free(victim->bitmap);
+        *victim = Entry();
+        return victim;
+    }
+
+    // ============================================================================
+    // ENCODING
+    // ============================================================================
+
+    const QRMatrix *QRCodeCache::encode(const char *content)
+    {
+        const size_t length = content ? strlen(content) : 0;
+        if (length == 0 || length > QR_CACHE_MAX_CONTENT) return nullptr;
+
+        const uint32_t h = hash(content);
+        Entry *entry = find(content, h);
+        if (entry)
+        {
+            entry->hits++;
+            entry->lastUsedMs = millis();
+            stats.matrixHits++;
+            return &entry->matrix;
+        }
+
+        const uint8_t version = versionFor(length);
+        if (version == 0)
+        {
+            Serial.printf("❌ QRCodeCache: payload of %d bytes exceeds version %d\n", (int)length, QR_CACHE_MAX_VERSION);
+            return nullptr;
+        }
+
+        entry = allocateEntry();
+
+        const uint32_t start = micros();
+        QRCode qrcode;
+        int8_t result = qrcode_initText(&qrcode, entry->modules, version, ECC_LOW, content);
+        stats.encodeUs += micros() - start;
+        stats.encodes++;
+
+        if (result != 0)
+        {
+            Serial.printf("❌ QRCodeCache: encode failed (error: %d)\n", result);
+            return nullptr;
+        }
+
+        memcpy(entry->content, content, length + 1);
+        entry->hash = h;
+        entry->matrix.size = qrcode.size;
+        entry->matrix.modules = entry->modules;
+        entry->lastUsedMs = millis();
+        return &entry->matrix;
+    }
+
+    // ============================================================================
+    // RENDERING
+    // ============================================================================
+
+    bool QRCodeCache::prepareCanvas(lv_obj_t *qr, int32_t sizePx)
+    {
+        lv_draw_buf_t *buf = lv_canvas_get_draw_buf(qr);
+        if (!buf || (int32_t)buf->header.w != sizePx || (int32_t)buf->header.h != sizePx)
+        {
+            lv_qrcode_set_size(qr, sizePx);
+            buf = lv_canvas_get_draw_buf(qr);
+        }
+        return buf && buf->header.cf == LV_COLOR_FORMAT_I1;
+    }
+
+    bool QRCodeCache::render(lv_obj_t *qr, const QRMatrix &matrix, int32_t sizePx, lv_color_t dark, lv_color_t light)
+    {
+        if (!qr || matrix.size == 0 || !prepareCanvas(qr, sizePx)) return false;
+
+        const int32_t scale = sizePx / matrix.size;
+        if (scale < 1) return false;
+        const int32_t margin = (sizePx - matrix.size * scale) / 2;
+
+        lv_draw_buf_t *buf = lv_canvas_get_draw_buf(qr);
+        const uint32_t stride = buf->header.stride;
+        uint8_t *pixels = (uint8_t *)lv_draw_buf_goto_xy(buf, 0, 0);
+
+        // Index 0 = light background, index 1 = dark module
+        lv_canvas_set_palette(qr, 0, lv_color_to_32(light, LV_OPA_COVER));
+        lv_canvas_set_palette(qr, 1, lv_color_to_32(dark, LV_OPA_COVER));
+        memset(pixels, 0, (size_t)stride * sizePx);
+
+        for (uint8_t y = 0; y < matrix.size; y++)
+        {
+            uint8_t *row = pixels + (size_t)(margin + y * scale) * stride;
+
+            for (uint8_t x = 0; x < matrix.size; x++)
+            {
+                if (!matrix.get(x, y)) continue;
+
+                const int32_t end = margin + (x + 1) * scale;
+                for (int32_t px = margin + x * scale; px < end; px++)
+                {
+                    row[px >> 3] |= 0x80 >> (px & 7);
+                }
+            }
+
+            // Module rows are identical - replicate the first pixel row
+            for (int32_t r = 1; r < scale; r++)
+            {
+                memcpy(row + (size_t)r * stride, row, stride);
+            }
+        }
+
+        lv_image_cache_drop(buf);
+        lv_obj_invalidate(qr);
+        return true;
+    }
+
+    void QRCodeCache::storeBitmap(Entry &entry, lv_obj_t *qr, int32_t sizePx, uint32_t colors)
+    {
+        const lv_draw_buf_t *buf = lv_canvas_get_draw_buf(qr);
+        if (!buf) return;
+
+        if (entry.bitmap && entry.bitmapBytes != buf->data_size)
+        {
+            heap_caps_free(entry.bitmap);
+            entry.bitmap = nullptr;
+        }
+        if (!entry.bitmap)
+        {
+            entry.bitmap = (uint8_t *)heap_caps_malloc(buf->data_size, MALLOC_CAP_SPIRAM);
+            if (!entry.bitmap) return; // Matrix cache still applies
+        }
+
+        memcpy(entry.bitmap, buf->data, buf->data_size);
+        entry.bitmapBytes = buf->data_size;
+        entry.bitmapPx = sizePx;
+        entry.bitmapColors = colors;
+    }
+
+    bool QRCodeCache::show(lv_obj_t *qr, const char *content, int32_t sizePx, lv_color_t dark, lv_color_t light)
+    {
+        if (!qr) return false;
+
+        const QRMatrix *matrix = encode(content);
+        if (!matrix) return false;
+
+        Entry *entry = find(content, hash(content));
+        const uint32_t colors = lv_color_to_int(dark) * 31u ^ lv_color_to_int(light);
+
+        // Bitmap hit: copy the previously rendered canvas back
+        if (entry->bitmap && entry->bitmapPx == sizePx && entry->bitmapColors == colors && prepareCanvas(qr, sizePx))
+        {
+            const uint32_t start = micros();
+            lv_draw_buf_t *buf = lv_canvas_get_draw_buf(qr);
+            if (buf->data_size == entry->bitmapBytes)
+            {
+                memcpy(buf->data, entry->bitmap, entry->bitmapBytes);
+                lv_image_cache_drop(buf);
+                lv_obj_invalidate(qr);
+                stats.bitmapHits++;
+                stats.bitmapHitUs += micros() - start;
+                return true;
+            }
+        }
+
+        const uint32_t start = micros();
+        if (!render(qr, *matrix, sizePx, dark, light)) return false;
+        stats.renders++;
+        stats.renderUs += micros() - start;
+
+        storeBitmap(*entry, qr, sizePx, colors);
+        return true;
+    }
+
+    // ============================================================================
+    // MAINTENANCE & REPORTING
+    // ============================================================================
+
+    void QRCodeCache::clear()
+    {
+        for (Entry &e : entries)
+        {
+            heap_caps_free(e.bitmap);
+            e = Entry();
+        }
+    }
+
+    void QRCodeCache::print() const
+    {
+        Serial.println("\n🔳 QR_CACHE_START");
+        Serial.println("  payload                           modules  hits   bitmap_B  px");
+
+        for (const Entry &e : entries)
+        {
+            if (!e.content[0]) continue;
+            Serial.printf("  %-33.33s %-8u %-6lu %-9lu %ld\n",
+                          e.content, e.matrix.size, (unsigned long)e.hits,
+                          (unsigned long)(e.bitmap ? e.bitmapBytes : 0), (long)e.bitmapPx);
+        }
+
+        Serial.printf("  encode:     %lu x avg %lu us\n", (unsigned long)stats.encodes,
+                      (unsigned long)(stats.encodes ? stats.encodeUs / stats.encodes : 0));
+        Serial.printf("  render:     %lu x avg %lu us\n", (unsigned long)stats.renders,
+                      (unsigned long)(stats.renders ? stats.renderUs / stats.renders : 0));
+        Serial.printf("  bitmap hit: %lu x avg %lu us (matrix hits: %lu)\n", (unsigned long)stats.bitmapHits,
+                      (unsigned long)(stats.bitmapHits ? stats.bitmapHitUs / stats.bitmapHits : 0),
+                      (unsigned long)stats.matrixHits);
+        Serial.println("🔳 QR_CACHE_END\n");
+    }
+
+} // namespace CloudMouse::Utils
@@ -0,0 +1,131 @@
+/**
+ * CloudMouse SDK - Content-Keyed QR Code Cache
+ *
+ * Encodes QR payloads once and renders them into LVGL QR code widgets without going
+ * through lv_qrcode_set_data(), which re-runs the Reed-Solomon encoder and repaints
+ * the whole canvas every time a setup screen is shown.
+ *
+ * Two cache levels, keyed by payload (FNV-1a hash + exact compare):
+ * - Module matrix: 1 bit per module, kept inline in the entry (internal RAM)
+ * - Rendered bitmap: the widget's I1 canvas after rendering, kept in PSRAM and keyed
+ *   additionally by pixel size and colours; a hit is a single memcpy
+ *
+ * Encoding:
+ * - Uses the QRCode library (same as QRCodeManager), low error correction, smallest
+ *   version up to QR_CACHE_MAX_VERSION that fits the payload in byte mode
+ *
+ * Timing:
+ * - Encode, render and bitmap-hit durations are accumulated for print()
+ *
+ * Thread Safety:
+ * - UI task only (touches LVGL objects)
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "QRMatrix.h"
+
+// Platform-specific QR code library includes
+#ifdef PLATFORMIO
+#include <qrcode.h>
+#else
+#include "QRCode.h"
+#endif
+
+// Cached payloads (least recently used entry is replaced)
+#define QR_CACHE_ENTRIES 4
+
+// Largest QR version encoded (57x57 modules, 271 bytes in byte mode at low ECC)
+#define QR_CACHE_MAX_VERSION 10
+
+// Longest payload stored for exact key comparison
+#define QR_CACHE_MAX_CONTENT 160
+
+namespace CloudMouse::Utils
+{
+    /**
+     * Cache hit/miss counters and accumulated timings
+     */
+    struct QRCacheStats
+    {
+        uint32_t encodes = 0;       // Matrix cache misses (library encode)
+        uint32_t matrixHits = 0;
+        uint32_t renders = 0;       // Matrix -> canvas renders
+        uint32_t bitmapHits = 0;    // Canvas restored from PSRAM
+        uint64_t encodeUs = 0;
+        uint64_t renderUs = 0;
+        uint64_t bitmapHitUs = 0;
+    };
+
+    class QRCodeCache
+    {
+    public:
+        ~QRCodeCache();
+
+        /**
+         * Get the module matrix for a payload, encoding it on first use
+         *
+         * @param content Payload (URL, WiFi credentials, ...)
+         * @return Matrix, or nullptr if the payload is empty or too long
+         */
+        const QRMatrix *encode(const char *content);
+
+        /**
+         * Show a payload in an lv_qrcode widget (I1 canvas of sizePx x sizePx)
+         * Restores the cached bitmap when available, otherwise renders the matrix.
+         *
+         * @param qr QR code widget created with lv_qrcode_create()
+         * @param content Payload
+         * @param sizePx Widget size in pixels (buffer is resized if needed)
+         * @param dark Module colour
+         * @param light Background colour
+         * @return true if the widget shows the payload
+         */
+        bool show(lv_obj_t *qr, const char *content, int32_t sizePx, lv_color_t dark, lv_color_t light);
+
+        /**
+         * Render a module matrix into an lv_qrcode widget (no caching)
+         * Modules are scaled by an integer factor and centred with a quiet margin.
+         */
+        static bool render(lv_obj_t *qr, const QRMatrix &matrix, int32_t sizePx, lv_color_t dark, lv_color_t light);
+
+        void clear();
+        const QRCacheStats &getStats() const { return stats; }
+
+        /**
+         * Print cached payloads and encode / render / hit timings to Serial
+         */
+        void print() const;
+
+    private:
+        struct Entry
+        {
+            uint32_t hash = 0;
+            char content[QR_CACHE_MAX_CONTENT + 1] = {};
+            uint8_t modules[(4 * QR_CACHE_MAX_VERSION + 17) * (4 * QR_CACHE_MAX_VERSION + 17) / 8 + 1] = {};
+            QRMatrix matrix;
+
+            // Rendered canvas (PSRAM)
+            uint8_t *bitmap = nullptr;
+            uint32_t bitmapBytes = 0;
+            int32_t bitmapPx = 0;
+            uint32_t bitmapColors = 0;  // Hash of dark/light colours
+
+            uint32_t hits = 0;
+            uint32_t lastUsedMs = 0;
+        };
+
+        Entry entries[QR_CACHE_ENTRIES];
+        QRCacheStats stats;
+
+        Entry *find(const char *content, uint32_t hash);
+        Entry *allocateEntry();
+        void storeBitmap(Entry &entry, lv_obj_t *qr, int32_t sizePx, uint32_t colors);
+        static bool prepareCanvas(lv_obj_t *qr, int32_t sizePx);
+        static uint32_t hash(const char *content);
+        static uint8_t versionFor(size_t length);
+    };
+
+} // namespace CloudMouse::Utils
@@ -6,9 +6,13 @@
  */
 
 #include "./QRCodeManager.h"
+#include "./QRBlitter.h"
+#include "../hardware/PixelConverter.h"
+#include <esp_heap_caps.h>
 
 namespace CloudMouse::Utils
 {
+    using CloudMouse::Hardware::PixelConverter;
 
     // ============================================================================
     // INITIALIZATION
@@ -47,6 +51,7 @@ namespace CloudMouse::Utils
         }
 
         // Allocate buffer for QR code data
+        QRCode qrcode;
         uint8_t qrcodeData[qrcode_getBufferSize(version)];
 
         // Generate QR code
@@ -60,12 +65,38 @@ namespace CloudMouse::Utils
         }
 
         valid = true;
+        matrix.size = qrcode.size;
+        matrix.modules = qrcodeData;
 
         Serial.printf("✅ QRCodeManager: Generated QR code %dx%d for content length %d\n",
                       qrcode.size, qrcode.size, strlen(content));
 
         // Render to sprite
         renderToSprite();
+
+        // Module buffer lives on the stack - only the size stays valid
+        matrix.modules = nullptr;
+    }
+
+    void QRCodeManager::create(const QRMatrix &encoded)
+    {
+        if (!sprite)
+        {
+            Serial.println("❌ QRCodeManager: Sprite not initialized");
+            valid = false;
+            return;
+        }
+
+        if (!encoded.modules || encoded.size == 0)
+        {
+            Serial.println("❌ QRCodeManager: Empty matrix provided");
+            valid = false;
+            return;
+        }
+
+        matrix = encoded;
+        valid = true;
+        renderToSprite();
     }
 
     // ============================================================================
@@ -80,7 +111,7 @@ namespace CloudMouse::Utils
 
     void QRCodeManager::setPixelSize(int pixelSize)
     {
-        pixelSide = pixelSize > 0 ? pixelSize : 1; // Minimum 1 pixel
+        pixelSide = pixelSize > 0 ? (pixelSize < 255 ? pixelSize : 255) : 1; // 1-255 pixels
     }
 
     // ============================================================================
@@ -89,12 +120,12 @@ namespace CloudMouse::Utils
 
     uint8_t QRCodeManager::getSize() const
     {
-        return valid ? qrcode.size : 0;
+        return valid ? matrix.size : 0;
     }
 
     int QRCodeManager::getPixelSize() const
     {
-        return valid ? (qrcode.size * pixelSide) : 0;
+        return valid ? (matrix.size * pixelSide) : 0;
     }
 
     bool QRCodeManager::isValid() const
@@ -108,30 +139,92 @@ namespace CloudMouse::Utils
 
     void QRCodeManager::renderToSprite()
     {
-        if (!valid || !sprite)
+        if (!valid || !sprite || !matrix.modules)
+        {
+            return;
+        }
+
+        const uint8_t scale = (uint8_t)pixelSide;
+        const int32_t width = QRBlitter::pixelSize(matrix, scale);
+        uint16_t *band = (uint16_t *)malloc((size_t)width * scale * sizeof(uint16_t));
+
+        if (!band)
         {
+            // Fallback: one rectangle per module
+            for (uint8_t y = 0; y < matrix.size; y++)
+            {
+                for (uint8_t x = 0; x < matrix.size; x++)
+                {
+                    uint16_t color = matrix.get(x, y) ? foregroundColor : backgroundColor;
+                    sprite->fillRect(offsetX + x * pixelSide, offsetY + y * pixelSide, pixelSide, pixelSide, color);
+                }
+            }
             return;
         }
 
-        // Render QR code modules to sprite
-        for (uint8_t y = 0; y < qrcode.size; y++)
+        // One scaled module row per push instead of one fillRect per module
+        for (uint8_t y = 0; y < matrix.size; y++)
         {
-            for (uint8_t x = 0; x < qrcode.size; x++)
+            QRBlitter::expandRow(band, matrix, y, scale, foregroundColor, backgroundColor);
+            for (uint8_t r = 1; r < scale; r++)
             {
-                // Get module state (true = black, false = white)
-                bool isBlack = qrcode_getModule(&qrcode, x, y);
+                memcpy(band + (size_t)r * width, band, (size_t)width * sizeof(uint16_t));
+            }
 
-                // Calculate pixel position
-                int pixelX = offsetX + (x * pixelSide);
-                int pixelY = offsetY + (y * pixelSide);
+            sprite->pushImage(offsetX, offsetY + y * pixelSide, width, pixelSide, (const lgfx::rgb565_t *)band);
+        }
 
-                // Choose color based on module state
-                uint16_t color = isBlack ? foregroundColor : backgroundColor;
+        free(band);
+    }
+
+    bool QRCodeManager::renderToPanel(lgfx::LGFX_Device &panel, const QRMatrix &encoded, int x, int y)
+    {
+        if (!encoded.modules || encoded.size == 0)
+        {
+            return false;
+        }
 
-                // Render module as filled rectangle
-                sprite->fillRect(pixelX, pixelY, pixelSide, pixelSide, color);
+        const uint8_t scale = (uint8_t)pixelSide;
+        const int32_t width = QRBlitter::pixelSize(encoded, scale);
+        const size_t bandPixels = (size_t)width * scale;
+
+        // RGB565 scratch row plus two RGB666 DMA bands (ping-pong)
+        uint16_t *row = (uint16_t *)malloc((size_t)width * sizeof(uint16_t));
+        uint8_t *bands[2] = {
+            (uint8_t *)heap_caps_malloc(PixelConverter::outputSize(bandPixels), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL),
+            (uint8_t *)heap_caps_malloc(PixelConverter::outputSize(bandPixels), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL)};
+
+        if (!row || !bands[0] || !bands[1])
+        {
+            Serial.println("❌ QRCodeManager: DMA band buffers unavailable");
+            free(row);
+            heap_caps_free(bands[0]);
+            heap_caps_free(bands[1]);
+            return false;
+        }
+
+        panel.startWrite();
+        for (uint8_t my = 0; my < encoded.size; my++)
+        {
+            uint8_t *band = bands[my & 1];
+
+            // Expand and convert while the previous band is still on the wire
+            QRBlitter::expandRow(row, encoded, my, scale, foregroundColor, backgroundColor);
+            PixelConverter::rgb565ToRgb666(band, row, width, false);
+            for (uint8_t r = 1; r < scale; r++)
+            {
+                memcpy(band + PixelConverter::outputSize((size_t)r * width), band, PixelConverter::outputSize(width));
             }
+
+            panel.waitDMA();
+            panel.pushImageDMA(x, y + my * pixelSide, width, pixelSide, (const lgfx::bgr888_t *)band);
         }
+        panel.endWrite();
+
+        free(row);
+        heap_caps_free(bands[0]);
+        heap_caps_free(bands[1]);
+        return true;
     }
 
     // ============================================================================
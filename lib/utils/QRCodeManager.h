@@ -8,7 +8,8 @@
  * - QR code generation with configurable error correction
  * - Flexible display interface (works with any graphics library)
  * - Configurable positioning and scaling
- * - Memory efficient rendering
+ * - Memory efficient rendering: scaled scanline bands instead of per-module fills,
+ *   optionally pushed straight to the panel with DMA
  */
 
 #ifndef QRCODEMANAGER_H
@@ -16,6 +17,7 @@
 
 #include <Arduino.h>
 #include "../hardware/LGFX_ILI9488.h"
+#include "QRMatrix.h"
 
 // Platform-specific QR code library includes
 #ifdef PLATFORMIO
@@ -58,6 +60,26 @@ namespace CloudMouse::Utils
          */
         void create(const char *content, uint8_t version, uint8_t ecc = 0);
 
+        /**
+         * Render an already encoded QR code (no encoding at runtime)
+         *
+         * @param matrix Module matrix, e.g. makeStaticQR(...).matrix() or QRCodeCache::encode()
+         */
+        void create(const QRMatrix &matrix);
+
+        /**
+         * Draw an encoded QR code straight to the panel with DMA, bypassing the sprite
+         * Uses the configured pixel size and colours. The caller must own the bus
+         * (not while LVGL is flushing).
+         *
+         * @param panel Display device
+         * @param matrix Module matrix (static or cached, must stay valid during the call)
+         * @param x Left edge on the panel
+         * @param y Top edge on the panel
+         * @return true if drawn, false if the matrix is empty or buffers are unavailable
+         */
+        bool renderToPanel(lgfx::LGFX_Device &panel, const QRMatrix &matrix, int x, int y);
+
         /**
          * Set rendering position offset
          *
@@ -69,7 +91,7 @@ namespace CloudMouse::Utils
         /**
          * Set pixel size for QR code modules
          *
-         * @param pixelSize Size of each QR code module in pixels
+         * @param pixelSize Size of each QR code module in pixels (1-255)
          */
         void setPixelSize(int pixelSize);
 
@@ -100,7 +122,7 @@ namespace CloudMouse::Utils
         static String generateTextQR(const String &text);
 
     private:
-        QRCode qrcode;                 // QR code data structure
+        QRMatrix matrix;               // Modules of the last QR code (size only for runtime content)
         LGFX_Sprite *sprite = nullptr; // Display sprite for rendering
 
         // Rendering configuration
@@ -113,7 +135,7 @@ namespace CloudMouse::Utils
         uint16_t foregroundColor = 0x0000; // Black (TFT_BLACK)
         uint16_t backgroundColor = 0xFFFF; // White (TFT_WHITE)
 
-        // Internal rendering function
+        // Internal rendering function (scaled scanline bands, see QRBlitter)
         void renderToSprite();
     };
 };
@@ -0,0 +1,31 @@
+/**
+ * CloudMouse SDK - QR Module Matrix
+ *
+ * Read-only view of an encoded QR symbol shared by the runtime encoder
+ * (QRCodeCache), compile-time encoded symbols (StaticQRCode) and the renderers
+ * (QRCodeCache for LVGL widgets, QRCodeManager for LovyanGFX sprites).
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace CloudMouse::Utils
+{
+    /**
+     * QR module matrix: size x size bits, row-major, MSB first, no row padding
+     * (same layout as the QRCode library's module buffer)
+     */
+    struct QRMatrix
+    {
+        uint8_t size = 0;
+        const uint8_t *modules = nullptr;
+
+        bool get(uint8_t x, uint8_t y) const
+        {
+            uint32_t offset = (uint32_t)y * size + x;
+            return (modules[offset >> 3] >> (7 - (offset & 7))) & 1;
+        }
+    };
+
+} // namespace CloudMouse::Utils
@@ -0,0 +1,450 @@
+/**
+ * CloudMouse SDK - Compile-Time QR Encoder
+ *
+ * Encodes string literals into QR module matrices during compilation, so constant
+ * payloads such as WIFI_CONFIG_SERVICE cost neither encode time nor RAM: the result
+ * is a constexpr object placed in flash (.rodata) and viewed through QRMatrix like
+ * any runtime-encoded symbol.
+ *
+ * Usage:
+ *   static constexpr auto CONFIG_QR = Utils::makeStaticQR(WIFI_CONFIG_SERVICE);
+ *   QRCodeCache::render(qr, CONFIG_QR.matrix(), 180, dark, light);   // LVGL widget
+ *   qrManager.create(CONFIG_QR.matrix());                            // LovyanGFX sprite
+ *
+ * Encoding:
+ * - Byte mode, low error correction, smallest version 1-10 that fits (same
+ *   parameters as QRCodeCache), mask chosen by the standard penalty rules
+ * - Payloads longer than 271 bytes fail to compile; dynamic content goes through
+ *   the runtime encoder (QRCodeCache::encode / QRCodeManager::create)
+ *
+ * Requires C++14 relaxed constexpr (the project builds as gnu++17, see platformio.ini);
+ * no lambdas or non-literal locals inside the encoder, so C++14 compilers accept it
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "QRMatrix.h"
+
+namespace CloudMouse::Utils
+{
+    namespace StaticQR
+    {
+        constexpr uint8_t MAX_VERSION = 10;
+        constexpr uint8_t MAX_SIZE = 4 * MAX_VERSION + 17;
+        constexpr uint16_t MAX_CODEWORDS = 346;
+
+        // Low error correction, versions 1-10
+        constexpr uint16_t TOTAL_CODEWORDS[MAX_VERSION] = {26, 44, 70, 100, 134, 172, 196, 242, 292, 346};
+        constexpr uint8_t EC_PER_BLOCK[MAX_VERSION] = {7, 10, 15, 20, 26, 18, 20, 24, 30, 18};
+        constexpr uint8_t BLOCKS[MAX_VERSION] = {1, 1, 1, 1, 1, 2, 2, 2, 2, 4};
+
+        constexpr uint16_t dataCodewords(uint8_t version)
+        {
+            return TOTAL_CODEWORDS[version - 1] - BLOCKS[version - 1] * EC_PER_BLOCK[version - 1];
+        }
+
+        constexpr uint8_t versionFor(size_t length)
+        {
+            for (uint8_t v = 1; v <= MAX_VERSION; v++)
+            {
+                const size_t headerBits = 4 + (v < 10 ? 8 : 16);
+                if (headerBits + length * 8 <= (size_t)dataCodewords(v) * 8) return v;
+            }
+            return 0;
+        }
+
+        // ========================================================================
+        // REED-SOLOMON (GF(256), polynomial 0x11D)
+        // ========================================================================
+
+        constexpr uint8_t gfMultiply(uint8_t x, uint8_t y)
+        {
+            int z = 0;
+            for (int i = 7; i >= 0; i--)
+            {
+                z = (z << 1) ^ ((z >> 7) * 0x11D);
+                z ^= ((y >> i) & 1) * x;
+            }
+            return (uint8_t)z;
+        }
+
+        struct Codewords
+        {
+            uint8_t data[MAX_CODEWORDS] = {};
+            uint16_t length = 0;
+        };
+
+        constexpr void appendBits(Codewords &out, uint32_t &bitLength, uint32_t value, uint8_t bits)
+        {
+            for (int i = bits - 1; i >= 0; i--, bitLength++)
+            {
+                if ((value >> i) & 1) out.data[bitLength >> 3] |= 0x80 >> (bitLength & 7);
+            }
+        }
+
+        /**
+         * Data codewords (mode, count, payload, terminator, padding) followed by the
+         * interleaved error correction codewords
+         */
+        constexpr Codewords buildCodewords(const char *text, size_t length, uint8_t version)
+        {
+            Codewords data;
+            const uint16_t dataLength = dataCodewords(version);
+
+            uint32_t bits = 0;
+            appendBits(data, bits, 0x4, 4); // Byte mode
+            appendBits(data, bits, (uint32_t)length, version < 10 ? 8 : 16);
+            for (size_t i = 0; i < length; i++) appendBits(data, bits, (uint8_t)text[i], 8);
+
+            const uint32_t capacity = (uint32_t)dataLength * 8;
+            appendBits(data, bits, 0, (uint8_t)(capacity - bits < 4 ? capacity - bits : 4));
+            bits = (bits + 7) & ~7u;
+            for (uint8_t pad = 0xEC; bits < capacity; pad ^= 0xEC ^ 0x11) appendBits(data, bits, pad, 8);
+
+            // Block layout: short blocks first, long blocks carry one extra data byte
+            const uint8_t blocks = BLOCKS[version - 1];
+            const uint8_t ecLength = EC_PER_BLOCK[version - 1];
+            const uint16_t total = TOTAL_CODEWORDS[version - 1];
+            const uint8_t shortBlocks = blocks - total % blocks;
+            const uint16_t shortData = total / blocks - ecLength;
+
+            uint8_t divisor[32] = {};
+            divisor[ecLength - 1] = 1;
+            uint8_t root = 1;
+            for (uint8_t i = 0; i < ecLength; i++)
+            {
+                for (uint8_t j = 0; j < ecLength; j++)
+                {
+                    divisor[j] = gfMultiply(divisor[j], root);
+                    if (j + 1 < ecLength) divisor[j] ^= divisor[j + 1];
+                }
+                root = gfMultiply(root, 0x02);
+            }
+
+            uint8_t ec[4][32] = {};
+            uint16_t blockStart[4] = {};
+            uint16_t start = 0;
+            for (uint8_t b = 0; b < blocks; b++)
+            {
+                const uint16_t blockData = shortData + (b < shortBlocks ? 0 : 1);
+                blockStart[b] = start;
+                for (uint16_t i = 0; i < blockData; i++)
+                {
+                    const uint8_t factor = data.data[start + i] ^ ec[b][0];
+                    for (uint8_t j = 0; j + 1 < ecLength; j++) ec[b][j] = ec[b][j + 1];
+                    ec[b][ecLength - 1] = 0;
+                    for (uint8_t j = 0; j < ecLength; j++) ec[b][j] ^= gfMultiply(divisor[j], factor);
+                }
+                start += blockData;
+            }
+
+            Codewords out;
+            for (uint16_t i = 0; i <= shortData; i++)
+            {
+                for (uint8_t b = 0; b < blocks; b++)
+                {
+                    if (i < shortData || b >= shortBlocks) out.data[out.length++] = data.data[blockStart[b] + i];
+                }
+            }
+            for (uint8_t i = 0; i < ecLength; i++)
+            {
+                for (uint8_t b = 0; b < blocks; b++) out.data[out.length++] = ec[b][i];
+            }
+            return out;
+        }
+
+        // ========================================================================
+        // MODULE PLACEMENT
+        // ========================================================================
+
+        struct Grid
+        {
+            uint8_t size = 0;
+            bool dark[MAX_SIZE][MAX_SIZE] = {};
+            bool function[MAX_SIZE][MAX_SIZE] = {};
+
+            constexpr void set(int x, int y, bool value)
+            {
+                dark[y][x] = value;
+                function[y][x] = true;
+            }
+        };
+
+        constexpr int absolute(int v) { return v < 0 ? -v : v; }
+        constexpr int maximum(int a, int b) { return a > b ? a : b; }
+
+        constexpr bool bitAt(uint32_t bits, int i) { return ((bits >> i) & 1) != 0; }
+
+        constexpr void drawFormatBits(Grid &g, uint8_t mask)
+        {
+            const uint32_t data = (1u << 3) | mask; // Low error correction = 0b01
+            uint32_t rem = data;
+            for (int i = 0; i < 10; i++) rem = (rem << 1) ^ ((rem >> 9) * 0x537);
+            const uint32_t bits = ((data << 10) | rem) ^ 0x5412;
+
+            for (int i = 0; i <= 5; i++) g.set(8, i, bitAt(bits, i));
+            g.set(8, 7, bitAt(bits, 6));
+            g.set(8, 8, bitAt(bits, 7));
+            g.set(7, 8, bitAt(bits, 8));
+            for (int i = 9; i < 15; i++) g.set(14 - i, 8, bitAt(bits, i));
+
+            for (int i = 0; i < 8; i++) g.set(g.size - 1 - i, 8, bitAt(bits, i));
+            for (int i = 8; i < 15; i++) g.set(8, g.size - 15 + i, bitAt(bits, i));
+            g.set(8, g.size - 8, true); // Dark module
+        }
+
+        constexpr void drawFunctionPatterns(Grid &g, uint8_t version)
+        {
+            for (int i = 0; i < g.size; i++)
+            {
+                g.set(6, i, i % 2 == 0);
+                g.set(i, 6, i % 2 == 0);
+            }
+
+            const int finders[3][2] = {{3, 3}, {g.size - 4, 3}, {3, g.size - 4}};
+            for (const auto &f : finders)
+            {
+                for (int dy = -4; dy <= 4; dy++)
+                {
+                    for (int dx = -4; dx <= 4; dx++)
+                    {
+                        const int x = f[0] + dx, y = f[1] + dy;
+                        const int dist = maximum(absolute(dx), absolute(dy));
+                        if (x >= 0 && x < g.size && y >= 0 && y < g.size) g.set(x, y, dist != 2 && dist != 4);
+                    }
+                }
+            }
+
+            // Alignment patterns: 6, (middle for v7+), size - 7
+            int positions[3] = {};
+            int count = 0;
+            if (version >= 2)
+            {
+                positions[count++] = 6;
+                if (version >= 7) positions[count++] = (6 + g.size - 7) / 2;
+                positions[count++] = g.size - 7;
+            }
+            for (int i = 0; i < count; i++)
+            {
+                for (int j = 0; j < count; j++)
+                {
+                    if ((i == 0 && j == 0) || (i == 0 && j == count - 1) || (i == count - 1 && j == 0)) continue;
+                    for (int dy = -2; dy <= 2; dy++)
+                    {
+                        for (int dx = -2; dx <= 2; dx++)
+                        {
+                            g.set(positions[i] + dx, positions[j] + dy, maximum(absolute(dx), absolute(dy)) != 1);
+                        }
+                    }
+                }
+            }
+
+            drawFormatBits(g, 0); // Reserve; real bits drawn once the mask is known
+
+            if (version >= 7)
+            {
+                uint32_t rem = version;
+                for (int i = 0; i < 12; i++) rem = (rem << 1) ^ ((rem >> 11) * 0x1F25);
+                const uint32_t bits = ((uint32_t)version << 12) | rem;
+                for (int i = 0; i < 18; i++)
+                {
+                    const bool bit = (bits >> i) & 1;
+                    const int a = g.size - 11 + i % 3, b = i / 3;
+                    g.set(a, b, bit);
+                    g.set(b, a, bit);
+                }
+            }
+        }
+
+        constexpr void drawCodewords(Grid &g, const Codewords &cw)
+        {
+            uint32_t i = 0;
+            for (int right = g.size - 1; right >= 1; right -= 2)
+            {
+                if (right == 6) right = 5;
+                const bool upward = ((right + 1) & 2) == 0;
+                for (int vert = 0; vert < g.size; vert++)
+                {
+                    for (int j = 0; j < 2; j++)
+                    {
+                        const int x = right - j;
+                        const int y = upward ? g.size - 1 - vert : vert;
+                        if (g.function[y][x] || i >= (uint32_t)cw.length * 8) continue;
+                        g.dark[y][x] = (cw.data[i >> 3] >> (7 - (i & 7))) & 1;
+                        i++;
+                    }
+                }
+            }
+        }
+
+        constexpr bool maskBit(uint8_t mask, int x, int y)
+        {
+            switch (mask)
+            {
+            case 0: return (x + y) % 2 == 0;
+            case 1: return y % 2 == 0;
+            case 2: return x % 3 == 0;
+            case 3: return (x + y) % 3 == 0;
+            case 4: return (x / 3 + y / 2) % 2 == 0;
+            case 5: return x * y % 2 + x * y % 3 == 0;
+            case 6: return (x * y % 2 + x * y % 3) % 2 == 0;
+            default: return ((x + y) % 2 + x * y % 3) % 2 == 0;
+            }
+        }
+
+        constexpr void applyMask(Grid &g, uint8_t mask)
+        {
+            for (int y = 0; y < g.size; y++)
+            {
+                for (int x = 0; x < g.size; x++)
+                {
+                    if (!g.function[y][x] && maskBit(mask, x, y)) g.dark[y][x] = !g.dark[y][x];
+                }
+            }
+        }
+
+        // ========================================================================
+        // MASK SELECTION (penalty rules N1-N4)
+        // ========================================================================
+
+        constexpr bool moduleAt(const Grid &g, bool horizontal, int line, int i)
+        {
+            return horizontal ? g.dark[line][i] : g.dark[i][line];
+        }
+
+        constexpr bool finderLike(const Grid &g, bool horizontal, int line, int i)
+        {
+            // 1:1:3:1:1 dark pattern with four light modules on one side
+            constexpr bool pattern[7] = {true, false, true, true, true, false, true};
+            if (i + 7 > g.size) return false;
+            for (int k = 0; k < 7; k++)
+            {
+                if (moduleAt(g, horizontal, line, i + k) != pattern[k]) return false;
+            }
+            bool before = i >= 4, after = i + 11 <= g.size;
+            for (int k = 1; k <= 4; k++)
+            {
+                if (before && moduleAt(g, horizontal, line, i - k)) before = false;
+                if (after && moduleAt(g, horizontal, line, i + 6 + k)) after = false;
+            }
+            return before || after;
+        }
+
+        constexpr uint32_t penalty(const Grid &g)
+        {
+            uint32_t score = 0;
+
+            for (int dir = 0; dir < 2; dir++)
+            {
+                const bool horizontal = dir == 0;
+                for (int line = 0; line < g.size; line++)
+                {
+                    int run = 1;
+                    for (int i = 1; i <= g.size; i++)
+                    {
+                        if (i < g.size && moduleAt(g, horizontal, line, i) == moduleAt(g, horizontal, line, i - 1))
+                        {
+                            run++;
+                            continue;
+                        }
+                        if (run >= 5) score += 3 + (run - 5);
+                        run = 1;
+                    }
+                    for (int i = 0; i < g.size; i++)
+                    {
+                        if (finderLike(g, horizontal, line, i)) score += 40;
+                    }
+                }
+            }
+
+            int darkCount = 0;
+            for (int y = 0; y < g.size; y++)
+            {
+                for (int x = 0; x < g.size; x++)
+                {
+                    darkCount += g.dark[y][x];
+                    if (x + 1 < g.size && y + 1 < g.size && g.dark[y][x] == g.dark[y][x + 1] &&
+                        g.dark[y][x] == g.dark[y + 1][x] && g.dark[y][x] == g.dark[y + 1][x + 1])
+                    {
+                        score += 3;
+                    }
+                }
+            }
+
+            const int total = g.size * g.size;
+            score += absolute(darkCount * 20 - total * 10) / total * 10;
+            return score;
+        }
+
+        constexpr Grid encode(const char *text, size_t length, uint8_t version)
+        {
+            Grid g;
+            g.size = 4 * version + 17;
+            drawFunctionPatterns(g, version);
+            drawCodewords(g, buildCodewords(text, length, version));
+
+            uint8_t best = 0;
+            uint32_t bestPenalty = UINT32_MAX;
+            for (uint8_t mask = 0; mask < 8; mask++)
+            {
+                Grid candidate = g;
+                applyMask(candidate, mask);
+                drawFormatBits(candidate, mask);
+                const uint32_t p = penalty(candidate);
+                if (p < bestPenalty)
+                {
+                    bestPenalty = p;
+                    best = mask;
+                }
+            }
+
+            applyMask(g, best);
+            drawFormatBits(g, best);
+            return g;
+        }
+
+    } // namespace StaticQR
+
+    /**
+     * QR symbol encoded at compile time, bit-packed in QRMatrix layout
+     *
+     * @tparam Length Payload length in bytes (without terminating NUL)
+     */
+    template <size_t Length>
+    struct StaticQRCode
+    {
+        static constexpr uint8_t VERSION = StaticQR::versionFor(Length);
+        static_assert(Length > 0 && VERSION != 0, "Payload does not fit a version 1-10 QR code - use the runtime encoder");
+
+        static constexpr uint8_t SIZE = 4 * VERSION + 17;
+        static constexpr size_t BYTES = ((size_t)SIZE * SIZE + 7) / 8;
+
+        uint8_t modules[BYTES] = {};
+
+        constexpr QRMatrix matrix() const { return QRMatrix{SIZE, modules}; }
+    };
+
+    /**
+     * Encode a string literal at compile time
+     * Assign the result to a static constexpr variable so it is evaluated by the
+     * compiler and stored in flash.
+     */
+    template <size_t N>
+    constexpr StaticQRCode<N - 1> makeStaticQR(const char (&text)[N])
+    {
+        StaticQRCode<N - 1> qr;
+        const StaticQR::Grid grid = StaticQR::encode(text, N - 1, StaticQRCode<N - 1>::VERSION);
+
+        for (uint32_t y = 0, offset = 0; y < grid.size; y++)
+        {
+            for (uint32_t x = 0; x < grid.size; x++, offset++)
+            {
+                if (grid.dark[y][x]) qr.modules[offset >> 3] |= 0x80 >> (offset & 7);
+            }
+        }
+        return qr;
+    }
+
+} // namespace CloudMouse::Utils
@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+"""
+CloudMouse SDK - Screen capture decoder
+
+Reassembles frames captured by lib/hardware/ScreenCapture from a byte stream
+(serial log, HTTP response body or host runner output) and writes them as PPM
+images. Log text interleaved with the packets is skipped, or echoed with --log.
+
+Sources:
+  - Serial:  stty -F /dev/ttyACM0 raw && cat /dev/ttyACM0 > capture.bin
+             then "display capture" or "display stream 2" on the serial console
+  - HTTP:    curl -o capture.bin http://192.168.4.1/capture   (setup portal)
+  - Host:    event DISPLAY_CAPTURE 0 / capture <name> in a cloudmouse_host script
+
+Usage:
+  tools/capture/decode_capture.py capture.bin --out frames/
+  cat /dev/ttyACM0 | tools/capture/decode_capture.py - --out frames/ --log
+
+Stream frames carry only the bands LVGL redrew; each one is applied to the
+canvas of the previous frame. After a lost packet the decoder waits for the
+next keyframe (full frame) before writing images again.
+"""
+
+import argparse
+import array
+import os
+import struct
+import sys
+
+MAGIC = b"CMCP"
+HEADER = struct.Struct("<BHH")  # flags, seq, len
+PACKET_FRAME_START = 0x01
+PACKET_FRAME_END = 0x02
+FRAME_KEYFRAME = 0x01
+FRAME_SWAPPED = 0x02
+MAX_PAYLOAD = 16 * 1024  # Sanity limit; the device default is 1024
+
+
+def fletcher16(data):
+    sum1 = sum2 = 0
+    for byte in data:
+        sum1 = (sum1 + byte) % 255
+        sum2 = (sum2 + sum1) % 255
+    return (sum2 << 8) | sum1
+
+
+def rgb565_table():
+    table = []
+    for value in range(65536):
+        r = (value >> 11) & 0x1F
+        g = (value >> 5) & 0x3F
+        b = value & 0x1F
+        table.append(bytes(((r * 255 + 15) // 31, (g * 255 + 31) // 63, (b * 255 + 15) // 31)))
+    return table
+
+
+class PacketReader:
+    """Finds checksummed packets in a byte stream that also carries log text"""
+
+    def __init__(self, on_packet, on_text=None):
+        self.buffer = bytearray()
+        self.on_packet = on_packet
+        self.on_text = on_text
+        self.bad_packets = 0
+        self.eof = False
+
+    def finish(self):
+        # Magic matches in trailing log text wait for bytes that never come
+        self.eof = True
+        self.feed(b"")
+
+    def feed(self, data):
+        self.buffer += data
+        while True:
+            start = self.buffer.find(MAGIC)
+            if start < 0:
+                # Keep a possible partial magic at the end
+                keep = len(MAGIC) - 1
+                self.text(self.buffer[:-keep] if len(self.buffer) > keep else b"")
+                del self.buffer[:max(0, len(self.buffer) - keep)]
+                return
+
+            self.text(self.buffer[:start])
+            del self.buffer[:start]
+
+            if len(self.buffer) < len(MAGIC) + HEADER.size:
+                if self.eof:
+                    self.text(self.buffer)
+                return
+            flags, seq, length = HEADER.unpack_from(self.buffer, len(MAGIC))
+            total = len(MAGIC) + HEADER.size + length + 2
+            if length > MAX_PAYLOAD:
+                del self.buffer[:1]
+                continue
+            if len(self.buffer) < total:
+                if not self.eof:
+                    return
+                del self.buffer[:1]
+                continue
+
+            body = bytes(self.buffer[len(MAGIC):total - 2])
+            checksum = self.buffer[total - 2] | (self.buffer[total - 1] << 8)
+            if fletcher16(body) != checksum:
+                # Magic inside log text or a corrupted packet: resync one byte later
+                self.bad_packets += 1
+                del self.buffer[:1]
+                continue
+
+            del self.buffer[:total]
+            self.on_packet(flags, seq, body[HEADER.size:])
+
+    def text(self, data):
+        if data and self.on_text:
+            self.on_text(bytes(data))
+
+
+class FrameDecoder:
+    """Applies the record stream of complete frames to an RGB565 canvas"""
+
+    def __init__(self, on_frame):
+        self.on_frame = on_frame
+        self.records = None
+        self.last_seq = None
+        self.canvas = None
+        self.width = self.height = 0
+        self.valid = False
+        self.lost_frames = 0
+
+    def packet(self, flags, seq, payload):
+        in_order = self.last_seq is not None and seq == (self.last_seq + 1) & 0xFFFF
+        self.last_seq = seq
+
+        if flags & PACKET_FRAME_START:
+            if not in_order:
+                self.valid = False  # Whatever came before is unknown: wait for a keyframe
+            if self.records is not None:
+                self.lost_frames += 1  # Previous frame never ended (dropped on the device)
+            self.records = bytearray()
+        elif self.records is None:
+            return
+        elif not in_order:
+            self.records = None
+            self.valid = False
+            self.lost_frames += 1
+            return
+
+        self.records += payload
+        if flags & PACKET_FRAME_END:
+            records, self.records = self.records, None
+            self.decode_frame(records)
+
+    def decode_frame(self, data):
+        if len(data) < 14 or data[0] != ord("F"):
+            self.lost_frames += 1
+            return
+
+        number, time_ms, width, height, flags = struct.unpack_from("<IIHHB", data, 1)
+        keyframe = bool(flags & FRAME_KEYFRAME)
+        if keyframe or self.canvas is None or (width, height) != (self.width, self.height):
+            self.canvas = array.array("H", bytes(width * height * 2))
+            self.width, self.height = width, height
+            self.valid = keyframe
+
+        pos = 14
+        bands = 0
+        while pos < len(data):
+            kind = data[pos]
+            pos += 1
+            if kind == ord("E"):
+                break
+            if kind != ord("B"):
+                self.lost_frames += 1
+                self.valid = False
+                return
+            x, y, w, h = struct.unpack_from("<HHHH", data, pos)
+            pos += 8
+            pos = self.decode_band(data, pos, x, y, w, h, flags & FRAME_SWAPPED)
+            bands += 1
+
+        if self.valid:
+            self.on_frame(number, time_ms, keyframe, bands, self)
+
+    def decode_band(self, data, pos, x, y, w, h, swapped):
+        pixels = array.array("H")
+        count = w * h
+        while len(pixels) < count:
+            header = data[pos] | (data[pos + 1] << 8)
+            pos += 2
+            if header & 0x8000:
+                value = data[pos] | (data[pos + 1] << 8)
+                pos += 2
+                pixels.extend(array.array("H", [value]) * (header & 0x7FFF))
+            else:
+                literal = array.array("H")
+                literal.frombytes(bytes(data[pos:pos + header * 2]))
+                if sys.byteorder != "little":
+                    literal.byteswap()
+                pixels.extend(literal)
+                pos += header * 2
+
+        if swapped:
+            pixels.byteswap()
+
+        for row in range(h):
+            if y + row >= self.height:
+                break
+            start = (y + row) * self.width + x
+            span = min(w, self.width - x)
+            self.canvas[start:start + span] = pixels[row * w:row * w + span]
+        return pos
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="captured byte stream, '-' for stdin")
+    parser.add_argument("--out", default=".", help="output directory for frame_<n>.ppm (default: %(default)s)")
+    parser.add_argument("--last", action="store_true", help="only write the final frame (as last.ppm)")
+    parser.add_argument("--log", action="store_true", help="echo interleaved log text to stdout")
+    args = parser.parse_args()
+
+    os.makedirs(args.out, exist_ok=True)
+    table = rgb565_table()
+    written = []
+
+    def write_frame(number, time_ms, keyframe, bands, decoder):
+        name = "last.ppm" if args.last else "frame_%06d.ppm" % number
+        path = os.path.join(args.out, name)
+        with open(path, "wb") as f:
+            f.write(b"P6\n%d %d\n255\n" % (decoder.width, decoder.height))
+            f.write(b"".join(table[p] for p in decoder.canvas))
+        written.append(number)
+        sys.stderr.write("frame %d  t=%d ms  %s  %d bands -> %s\n"
+                         % (number, time_ms, "key" if keyframe else "delta", bands, path))
+
+    def echo(text):
+        sys.stdout.write(text.decode("utf-8", errors="replace"))
+
+    decoder = FrameDecoder(write_frame)
+    reader = PacketReader(decoder.packet, echo if args.log else None)
+
+    source = sys.stdin.buffer if args.input == "-" else open(args.input, "rb")
+    try:
+        while True:
+            chunk = source.read1(65536) if hasattr(source, "read1") else source.read(65536)
+            if not chunk:
+                break
+            reader.feed(chunk)
+        reader.finish()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if source is not sys.stdin.buffer:
+            source.close()
+
+    sys.stderr.write("%d frames written, %d lost, %d corrupt packets skipped\n"
+                     % (len(written), decoder.lost_frames, reader.bad_packets))
+    if not written:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
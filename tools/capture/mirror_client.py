@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""
+CloudMouse SDK - Display mirror client
+
+Connects to the DisplayMirror WebSocket (lib/network/DisplayMirror), decodes the
+capture packets it forwards and writes the frames as PPM images. A scriptable
+alternative to the browser viewer, e.g. against the headless host runner:
+
+  ./build-host/cloudmouse_host tools/host/scripts/mirror.txt   # "mirror 8081" + "serve <ms>"
+  tools/capture/mirror_client.py localhost:8081 --out frames/ --seconds 5
+
+On a device: "display mirror on" on the serial console, then
+  tools/capture/mirror_client.py 192.168.1.42:81 --out frames/ --last
+
+Only the standard library is used (minimal RFC 6455 client, no extensions).
+"""
+
+import argparse
+import base64
+import os
+import socket
+import struct
+import sys
+import time
+
+from decode_capture import FrameDecoder, HEADER, MAGIC, fletcher16, rgb565_table
+
+
+def handshake(sock, host):
+    key = base64.b64encode(os.urandom(16)).decode()
+    sock.sendall(("GET /ws HTTP/1.1\r\nHost: %s\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                  "Sec-WebSocket-Key: %s\r\nSec-WebSocket-Version: 13\r\n\r\n" % (host, key)).encode())
+
+    response = b""
+    while b"\r\n\r\n" not in response:
+        chunk = sock.recv(1024)
+        if not chunk:
+            raise ConnectionError("connection closed during handshake")
+        response += chunk
+
+    head, _, rest = response.partition(b"\r\n\r\n")
+    if not head.startswith(b"HTTP/1.1 101"):
+        raise ConnectionError(head.split(b"\r\n")[0].decode(errors="replace"))
+    return rest
+
+
+def read_messages(sock, buffer):
+    """Yields (opcode, payload) of server frames (servers never mask)"""
+    while True:
+        while len(buffer) >= 2:
+            length = buffer[1] & 0x7F
+            pos = 2
+            if length == 126:
+                if len(buffer) < 4:
+                    break
+                length = struct.unpack_from(">H", buffer, 2)[0]
+                pos = 4
+            elif length == 127:
+                if len(buffer) < 10:
+                    break
+                length = struct.unpack_from(">Q", buffer, 2)[0]
+                pos = 10
+            if len(buffer) < pos + length:
+                break
+            opcode = buffer[0] & 0x0F
+            payload = bytes(buffer[pos:pos + length])
+            del buffer[:pos + length]
+            yield opcode, payload
+
+        chunk = sock.recv(65536)
+        if not chunk:
+            return
+        buffer += chunk
+
+
+def send_close(sock):
+    mask = os.urandom(4)
+    payload = bytes(b ^ mask[i % 4] for i, b in enumerate(struct.pack(">H", 1000)))
+    try:
+        sock.sendall(bytes((0x88, 0x80 | len(payload))) + mask + payload)
+    except OSError:
+        pass
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("address", help="host:port of the mirror (device default port 81)")
+    parser.add_argument("--out", default=".", help="output directory for frame_<n>.ppm (default: %(default)s)")
+    parser.add_argument("--last", action="store_true", help="only write the final frame (as last.ppm)")
+    parser.add_argument("--seconds", type=float, default=0, help="disconnect after this long (default: until closed)")
+    args = parser.parse_args()
+
+    host, _, port = args.address.partition(":")
+    os.makedirs(args.out, exist_ok=True)
+    table = rgb565_table()
+    written = []
+    stats = {"messages": 0, "bytes": 0, "bad": 0}
+
+    def write_frame(number, time_ms, keyframe, bands, decoder):
+        name = "last.ppm" if args.last else "frame_%06d.ppm" % number
+        path = os.path.join(args.out, name)
+        with open(path, "wb") as f:
+            f.write(b"P6\n%d %d\n255\n" % (decoder.width, decoder.height))
+            f.write(b"".join(table[p] for p in decoder.canvas))
+        written.append(number)
+        sys.stderr.write("frame %d  t=%d ms  %s  %d bands -> %s\n"
+                         % (number, time_ms, "key" if keyframe else "delta", bands, path))
+
+    decoder = FrameDecoder(write_frame)
+    sock = socket.create_connection((host, int(port or 81)), timeout=5)
+    buffer = bytearray(handshake(sock, args.address))
+    sys.stderr.write("connected to %s\n" % args.address)
+
+    deadline = time.monotonic() + args.seconds if args.seconds > 0 else None
+    sock.settimeout(0.5)
+    try:
+        while deadline is None or time.monotonic() < deadline:
+            try:
+                for opcode, payload in read_messages(sock, buffer):
+                    if opcode == 0x8:
+                        sys.stderr.write("closed by device\n")
+                        sock.close()
+                        return finish(decoder, written, stats)
+                    if opcode != 0x2:
+                        continue
+
+                    # One capture packet per binary message
+                    stats["messages"] += 1
+                    stats["bytes"] += len(payload)
+                    body = payload[len(MAGIC):-2]
+                    if not payload.startswith(MAGIC) or fletcher16(body) != struct.unpack("<H", payload[-2:])[0]:
+                        stats["bad"] += 1
+                        continue
+                    flags, seq, _ = HEADER.unpack_from(body)
+                    decoder.packet(flags, seq, body[HEADER.size:])
+
+                    if deadline is not None and time.monotonic() >= deadline:
+                        break
+                else:
+                    sys.stderr.write("connection closed\n")
+                    break
+            except socket.timeout:
+                continue
+    except KeyboardInterrupt:
+        pass
+
+    send_close(sock)
+    sock.close()
+    finish(decoder, written, stats)
+
+
+def finish(decoder, written, stats):
+    sys.stderr.write("%d frames written, %d lost, %d messages (%.1f KB), %d corrupt\n"
+                     % (len(written), decoder.lost_frames, stats["messages"], stats["bytes"] / 1024.0, stats["bad"]))
+    if not written:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,65 @@
+"""
+CloudMouse SDK - PlatformIO pre-build step for font subsetting
+
+Registered in platformio.ini as `extra_scripts = pre:tools/fonts/pio_subset_fonts.py`.
+Regenerates lib/fonts/ with tools/fonts/subset_fonts.py whenever the UI string table
+or the generator is newer than the generated fonts, so the firmware always links the
+subset fonts instead of the full Montserrat 20/28 px sizes.
+
+TTF lookup (first match):
+  1. CLOUDMOUSE_FONT_TTF environment variable
+  2. Montserrat-Medium.ttf shipped with the LVGL library in .pio/libdeps/<env>/lvgl
+
+Without a TTF or Node.js the step prints a warning and the build continues with the
+full built-in fonts (or the previously generated lib/fonts/).
+"""
+
+import os
+import shutil
+import subprocess
+import sys
+
+Import("env")  # noqa: F821 - provided by PlatformIO
+
+PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+GENERATOR = os.path.join(PROJECT_DIR, "tools", "fonts", "subset_fonts.py")
+STRINGS = os.path.join(PROJECT_DIR, "lib", "config", "UiStrings.h")
+OUTPUT = os.path.join(PROJECT_DIR, "lib", "fonts", "UiFonts.cpp")
+
+
+def find_ttf():
+    ttf = os.environ.get("CLOUDMOUSE_FONT_TTF")
+    if ttf:
+        return ttf if os.path.isfile(ttf) else None
+
+    libdeps = env.subst("$PROJECT_LIBDEPS_DIR/$PIOENV")  # noqa: F821
+    ttf = os.path.join(libdeps, "lvgl", "scripts", "built_in_font", "Montserrat-Medium.ttf")
+    return ttf if os.path.isfile(ttf) else None
+
+
+def up_to_date():
+    if not os.path.isfile(OUTPUT):
+        return False
+    generated = os.path.getmtime(OUTPUT)
+    return all(os.path.getmtime(src) <= generated for src in (STRINGS, GENERATOR))
+
+
+def main():
+    if up_to_date():
+        return
+
+    ttf = find_ttf()
+    if not ttf:
+        print("⚠️ Font subsetting skipped: no Montserrat TTF (set CLOUDMOUSE_FONT_TTF)")
+        return
+    if not shutil.which("npx"):
+        print("⚠️ Font subsetting skipped: Node.js (npx) not found")
+        return
+
+    print("🔤 Generating subset UI fonts from %s" % os.path.relpath(STRINGS, PROJECT_DIR))
+    result = subprocess.run([sys.executable, GENERATOR, "--ttf", ttf])
+    if result.returncode != 0:
+        print("⚠️ Font subsetting failed - building with the previous fonts")
+
+
+main()
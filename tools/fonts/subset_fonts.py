@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""
+CloudMouse SDK - Build-time font subsetting
+
+Generates LVGL fonts that only contain the glyphs used by each section of
+lib/config/UiStrings.h, and reports the flash saved against the full ASCII
+range at the same size.
+
+Requirements:
+  - Node.js; lv_font_conv is run through npx, pinned to LV_FONT_CONV (1.5.3) so
+    regenerated fonts are reproducible, and installed on first use
+  - A Montserrat TTF, e.g. lvgl/scripts/built_in_font/Montserrat-Medium.ttf
+
+Usage:
+  tools/fonts/subset_fonts.py --ttf path/to/Montserrat-Medium.ttf
+
+PlatformIO builds run this automatically (tools/fonts/pio_subset_fonts.py).
+
+Output (commit both files after regenerating, for Arduino IDE builds):
+  lib/fonts/UiFonts.cpp           all subset fonts, one translation unit
+  lib/fonts/UiFontsGenerated.h    declarations, UI_FONT_<NAME> role macros and
+                                  UI_FONTS_BITMAP_BYTES (sizes the RAM font cache)
+
+lib/hardware/UiFonts.h picks the generated fonts up automatically and
+lib/config/lv_conf.h drops the full Montserrat sizes once they exist.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+STRINGS = os.path.join(ROOT, "lib", "config", "UiStrings.h")
+OUT_DIR = os.path.join(ROOT, "lib", "fonts")
+
+SECTION_RE = re.compile(r'//\s*@font\s+(\w+)\s+(\w+)(?:\s+extra="((?:[^"\\]|\\.)*)")?')
+LITERAL_RE = re.compile(r'"((?:[^"\\]|\\.)*)"')
+PLACEHOLDER_RE = re.compile(r'%[-+ #0]*\d*(?:\.\d+)?[hlLzjt]*[diouxXeEfgGcsp%]')
+STATIC_RE = re.compile(r'^static\b[^=;(]*?\b([A-Za-z_]\w*)\s*(?:\[[^\]]*\])?\s*(?:=|;)', re.M)
+
+# lv_fmt_txt glyph descriptor size in LVGL v9 (bitfields packed into 8 bytes)
+GLYPH_DSC_BYTES = 8
+
+
+def unescape(text):
+    return bytes(text, "utf-8").decode("unicode_escape").encode("latin-1").decode("utf-8")
+
+
+def parse_sections(path):
+    """Return [(name, size, glyph set)] for every subset section of the string table."""
+    sections = []
+    current = None
+
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            marker = SECTION_RE.search(line)
+            if marker:
+                name, size, extra = marker.groups()
+                current = None
+                if size != "default":
+                    current = (name, int(size), set(" "))
+                    if extra:
+                        current[2].update(unescape(extra))
+                    sections.append(current)
+                continue
+
+            if current is None or line.lstrip().startswith("//"):
+                continue
+
+            for literal in LITERAL_RE.findall(line):
+                current[2].update(PLACEHOLDER_RE.sub("", unescape(literal)))
+
+    return sections
+
+
+# Pinned converter release; bump deliberately, output changes between versions
+LV_FONT_CONV = "lv_font_conv@1.5.3"
+
+
+def run_font_conv(ttf, size, font_name, output, symbols=None, char_range=None):
+    cmd = ["npx", "--yes", LV_FONT_CONV, "--font", ttf, "--size", str(size), "--bpp", "4",
+           "--format", "lvgl", "--no-compress", "--lv-font-name", font_name, "-o", output]
+    if symbols is not None:
+        cmd[7:7] = ["--symbols", symbols]
+    if char_range is not None:
+        cmd[7:7] = ["--range", char_range]
+    subprocess.run(cmd, check=True)
+
+
+def measure(source):
+    """Approximate flash footprint of a generated font: bitmap bytes + glyph descriptors."""
+    bitmap = re.search(r'glyph_bitmap\[\]\s*=\s*\{(.*?)\};', source, re.S)
+    bitmap_bytes = len(re.findall(r'0x[0-9a-fA-F]{2}', bitmap.group(1))) if bitmap else 0
+    glyphs = len(re.findall(r'\.bitmap_index\s*=', source))
+    return glyphs, bitmap_bytes + glyphs * GLYPH_DSC_BYTES, bitmap_bytes
+
+
+def make_unit(source, font_name):
+    """Strip includes and prefix file-local symbols so several fonts share one file."""
+    source = re.sub(r'#ifdef LV_LVGL_H_INCLUDE_SIMPLE.*?#endif\n', "", source, flags=re.S)
+    for symbol in sorted(set(STATIC_RE.findall(source)), key=len, reverse=True):
+        # Designators (.glyph_bitmap = ...) share names with the symbols - leave them alone
+        source = re.sub(r'(?<![\w.])%s\b' % symbol, "%s_%s" % (font_name, symbol), source)
+    return source
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--ttf", required=True, help="Montserrat TTF used by the built-in LVGL fonts")
+    parser.add_argument("--strings", default=STRINGS, help="UI string table (default: %(default)s)")
+    parser.add_argument("--out", default=OUT_DIR, help="output directory (default: %(default)s)")
+    args = parser.parse_args()
+
+    sections = parse_sections(args.strings)
+    if not sections:
+        sys.exit("no @font sections found in %s" % args.strings)
+
+    os.makedirs(args.out, exist_ok=True)
+    units = []
+    report = []
+
+    with tempfile.TemporaryDirectory() as tmp:
+        for name, size, glyphs in sections:
+            font_name = "ui_font_%s_%d" % (name, size)
+            symbols = "".join(sorted(glyphs))
+
+            subset_path = os.path.join(tmp, font_name + ".c")
+            run_font_conv(args.ttf, size, font_name, subset_path, symbols=symbols)
+            with open(subset_path, encoding="utf-8") as f:
+                subset = f.read()
+
+            full_path = os.path.join(tmp, font_name + "_full.c")
+            run_font_conv(args.ttf, size, font_name, full_path, char_range="0x20-0x7F")
+            with open(full_path, encoding="utf-8") as f:
+                full = f.read()
+
+            units.append((name, font_name, make_unit(subset, font_name)))
+            report.append((font_name, size, measure(subset), measure(full)))
+
+    with open(os.path.join(args.out, "UiFontsGenerated.h"), "w", encoding="utf-8") as f:
+        f.write("/**\n * CloudMouse SDK - Generated UI subset fonts\n"
+                " * Generated by tools/fonts/subset_fonts.py from lib/config/UiStrings.h - do not edit.\n */\n\n"
+                "#pragma once\n\n#include <lvgl.h>\n\n#define UI_FONTS_SUBSET 1\n\n")
+        for name, font_name, _ in units:
+            f.write("LV_FONT_DECLARE(%s)\n" % font_name)
+        f.write("\n")
+        for name, font_name, _ in units:
+            f.write("#define UI_FONT_%s (&%s)\n" % (name.upper(), font_name))
+        f.write("\n// Glyph bitmap bytes of all subset fonts (FontCache budget)\n")
+        f.write("#define UI_FONTS_BITMAP_BYTES %d\n" % sum(bitmap for _, _, (_, _, bitmap), _ in report))
+
+    with open(os.path.join(args.out, "UiFonts.cpp"), "w", encoding="utf-8") as f:
+        f.write("/**\n * CloudMouse SDK - Generated UI subset fonts\n"
+                " * Generated by tools/fonts/subset_fonts.py from lib/config/UiStrings.h - do not edit.\n */\n\n"
+                '#include "./UiFontsGenerated.h"\n')
+        for _, _, unit in units:
+            f.write("\n" + unit)
+
+    print("\nfont                       size  glyphs (subset/ascii)  flash bytes (subset/ascii)  saved")
+    total_saved = 0
+    for font_name, size, (glyphs, size_subset, _), (glyphs_full, size_full, _) in report:
+        saved = size_full - size_subset
+        total_saved += saved
+        print("%-26s %-5d %6d / %-13d %8d / %-17d %d" % (font_name, size, glyphs, glyphs_full,
+                                                          size_subset, size_full, saved))
+    print("\nTotal flash saved vs. full ASCII fonts: %d bytes" % total_saved)
+    print("(built-in Montserrat fonts also carry ~60 symbol glyphs, so the real saving is larger)")
+
+
+if __name__ == "__main__":
+    main()
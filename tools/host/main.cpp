@@ -0,0 +1,280 @@
+/**
+ * CloudMouse SDK - Headless Display Runner
+ *
+ * Runs the real DisplayManager and LVGL against the in-memory framebuffer panel and
+ * replays an event script, so UI rendering can be profiled and regression-tested on
+ * any Linux machine.
+ *
+ * Usage:
+ *   cloudmouse_host <script> [--out DIR] [--csv FILE]
+ *
+ * Script commands (one per line, '#' starts a comment):
+ *   event <EVENT_TYPE> [value] [string]  Queue event to the UI (same path as Core)
+ *   wait <ms>                            Run the UI loop for <ms> of virtual time (33ms frames)
+ *   dump <name>                          Write current panel contents to DIR/<name>.ppm
+ *   stats                                Print per-screen render statistics
+ *   bench <iterations>                   Run full-screen redraw benchmark
+ *   qrbench <iterations> [scale]         Compare per-module vs row-blit QR rendering (version 6)
+ *   capture <name>                       Write queued capture packets to DIR/<name>.cap
+ *                                        (start with "event DISPLAY_CAPTURE <fps|0>", decode with
+ *                                        tools/capture/decode_capture.py)
+ *   mirror <port>                        Serve the display mirror viewer on localhost:<port>
+ *   serve <ms>                           Run <ms> in real time (33ms frames) while the mirror
+ *                                        talks to its viewer (open http://localhost:<port>/)
+ *
+ * Output:
+ *   One CSV row per rendered frame: virtual time, screen, total/render/transfer time,
+ *   invalidated and pushed pixels, flush calls
+ */
+
+#include <Arduino.h>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include "../../lib/core/EventBus.h"
+#include "../../lib/hardware/DisplayManager.h"
+#include "../../lib/network/DisplayMirror.h"
+#include "../../lib/utils/QRBlitter.h"
+#include "../../lib/utils/StaticQRCode.h"
+
+using namespace CloudMouse;
+using namespace CloudMouse::Hardware;
+
+namespace
+{
+    const uint32_t FRAME_MS = 33; // Same cadence as Core::runUITask
+
+    // Version 6 symbol (41x41), the QRCodeManager default size
+    constexpr auto BENCH_QR = Utils::makeStaticQR(
+        "WIFI:T:WPA;S:CloudMouse-00000000;P:0000000000000000;H:false;;"
+        "https://cloudmouse.example/setup?device=00000000&step=wifi");
+
+    struct EventName
+    {
+        const char *name;
+        EventType type;
+    };
+
+    const EventName eventNames[] = {
+        {"BOOTING_COMPLETE", EventType::BOOTING_COMPLETE},
+        {"ENCODER_ROTATION", EventType::ENCODER_ROTATION},
+        {"ENCODER_CLICK", EventType::ENCODER_CLICK},
+        {"ENCODER_LONG_PRESS", EventType::ENCODER_LONG_PRESS},
+        {"DISPLAY_WAKE_UP", EventType::DISPLAY_WAKE_UP},
+        {"DISPLAY_UPDATE", EventType::DISPLAY_UPDATE},
+        {"DISPLAY_CLEAR", EventType::DISPLAY_CLEAR},
+        {"DISPLAY_WIFI_CONNECTING", EventType::DISPLAY_WIFI_CONNECTING},
+        {"DISPLAY_WIFI_CONNECTED", EventType::DISPLAY_WIFI_CONNECTED},
+        {"DISPLAY_WIFI_ERROR", EventType::DISPLAY_WIFI_ERROR},
+        {"DISPLAY_WIFI_AP_MODE", EventType::DISPLAY_WIFI_AP_MODE},
+        {"DISPLAY_WIFI_SETUP_URL", EventType::DISPLAY_WIFI_SETUP_URL},
+        {"DISPLAY_REDRAW_OVERLAY", EventType::DISPLAY_REDRAW_OVERLAY},
+        {"DISPLAY_SCREEN_STATS", EventType::DISPLAY_SCREEN_STATS},
+        {"DISPLAY_FONT_BENCHMARK", EventType::DISPLAY_FONT_BENCHMARK},
+        {"DISPLAY_QR_STATS", EventType::DISPLAY_QR_STATS},
+        {"DISPLAY_STYLE_BENCHMARK", EventType::DISPLAY_STYLE_BENCHMARK},
+        {"DISPLAY_LIST_DEMO", EventType::DISPLAY_LIST_DEMO},
+        {"DISPLAY_PERF_HUD", EventType::DISPLAY_PERF_HUD},
+        {"DISPLAY_CAPTURE", EventType::DISPLAY_CAPTURE},
+        {"DISPLAY_COLOR_MODE", EventType::DISPLAY_COLOR_MODE},
+    };
+
+    DisplayManager display;
+    Network::DisplayMirror mirror;
+    FILE *csv = stdout;
+    uint32_t lastFrameIndex = 0;
+
+    bool parseEventType(const std::string &name, EventType &type)
+    {
+        for (const EventName &entry : eventNames)
+        {
+            if (name == entry.name)
+            {
+                type = entry.type;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void runFrames(uint32_t ms)
+    {
+        for (uint32_t elapsed = 0; elapsed < ms; elapsed += FRAME_MS)
+        {
+            HostClock::advance(FRAME_MS);
+            display.update();
+            mirror.update();
+
+            const RenderFrameSample &frame = display.getRenderStats().getLastFrame();
+            if (frame.index != lastFrameIndex)
+            {
+                lastFrameIndex = frame.index;
+                fprintf(csv, "%u,%u,%u,%u,%u,%u,%u,%u,%u\n",
+                        frame.index, millis(), frame.screen, frame.totalUs,
+                        frame.totalUs - frame.transferUs, frame.transferUs,
+                        frame.invalidatedPixels, frame.pushedPixels, frame.flushes);
+            }
+        }
+    }
+
+    // Real-time frames, so a browser or client can follow the mirror
+    void serveFrames(uint32_t ms)
+    {
+        for (uint32_t elapsed = 0; elapsed < ms; elapsed += FRAME_MS)
+        {
+            runFrames(FRAME_MS);
+            std::this_thread::sleep_for(std::chrono::milliseconds(FRAME_MS));
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <script> [--out DIR] [--csv FILE]\n", argv[0]);
+        return 2;
+    }
+
+    std::string outDir = ".";
+    for (int i = 2; i + 1 < argc; i += 2)
+    {
+        std::string opt = argv[i];
+        if (opt == "--out")
+        {
+            outDir = argv[i + 1];
+        }
+        else if (opt == "--csv")
+        {
+            csv = fopen(argv[i + 1], "w");
+            if (!csv)
+            {
+                fprintf(stderr, "cannot open %s\n", argv[i + 1]);
+                return 1;
+            }
+        }
+    }
+
+    std::ifstream script(argv[1]);
+    if (!script)
+    {
+        fprintf(stderr, "cannot open script %s\n", argv[1]);
+        return 1;
+    }
+
+    EventBus::instance().initialize();
+    display.init();
+
+    fprintf(csv, "frame,time_ms,screen,total_us,render_us,transfer_us,invalidated_px,pushed_px,flushes\n");
+
+    std::string line;
+    int lineNo = 0;
+    while (std::getline(script, line))
+    {
+        lineNo++;
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+
+        std::istringstream in(line);
+        std::string cmd;
+        if (!(in >> cmd)) continue;
+
+        if (cmd == "event")
+        {
+            std::string name;
+            int32_t value = 0;
+            std::string text;
+            in >> name >> value;
+            std::getline(in >> std::ws, text);
+
+            EventType type;
+            if (!parseEventType(name, type))
+            {
+                fprintf(stderr, "line %d: unknown event '%s'\n", lineNo, name.c_str());
+                return 1;
+            }
+
+            Event event(type, value);
+            if (!text.empty()) event.setStringData(text.c_str());
+            EventBus::instance().sendToUI(event);
+        }
+        else if (cmd == "wait")
+        {
+            uint32_t ms = 0;
+            in >> ms;
+            runFrames(ms);
+        }
+        else if (cmd == "dump")
+        {
+            std::string name;
+            in >> name;
+            std::string path = outDir + "/" + name + ".ppm";
+            if (!display.getPanel().writePPM(path.c_str()))
+            {
+                fprintf(stderr, "line %d: cannot write %s\n", lineNo, path.c_str());
+                return 1;
+            }
+        }
+        else if (cmd == "stats")
+        {
+            display.printRenderStats(false);
+        }
+        else if (cmd == "bench")
+        {
+            int iterations = 10;
+            in >> iterations;
+            display.runRedrawBenchmark(iterations);
+        }
+        else if (cmd == "qrbench")
+        {
+            int iterations = 100;
+            int scale = 3;
+            in >> iterations >> scale;
+            if (!Utils::QRBlitter::runBenchmark(BENCH_QR.matrix(), (uint8_t)scale, iterations)) return 1;
+        }
+        else if (cmd == "capture")
+        {
+            std::string name;
+            in >> name;
+            std::string path = outDir + "/" + name + ".cap";
+            FILE *out = fopen(path.c_str(), "wb");
+            if (!out)
+            {
+                fprintf(stderr, "line %d: cannot write %s\n", lineNo, path.c_str());
+                return 1;
+            }
+
+            uint8_t packet[CAPTURE_PACKET_MAX_BYTES];
+            size_t bytes;
+            while ((bytes = display.getCapture().readPacket(packet, sizeof(packet))) > 0)
+            {
+                fwrite(packet, 1, bytes, out);
+            }
+            fclose(out);
+        }
+        else if (cmd == "mirror")
+        {
+            int port = MIRROR_PORT;
+            in >> port;
+            if (!mirror.begin(&display.getCapture(), (uint16_t)port))
+            {
+                fprintf(stderr, "line %d: mirror already running\n", lineNo);
+                return 1;
+            }
+        }
+        else if (cmd == "serve")
+        {
+            uint32_t ms = 0;
+            in >> ms;
+            serveFrames(ms);
+        }
+        else
+        {
+            fprintf(stderr, "line %d: unknown command '%s'\n", lineNo, cmd.c_str());
+            return 1;
+        }
+    }
+
+    if (csv != stdout) fclose(csv);
+    return 0;
+}
@@ -0,0 +1,137 @@
+/**
+ * CloudMouse SDK - Host Build Arduino Shim
+ *
+ * Minimal Arduino core replacement for compiling UI modules on Linux.
+ * Only the surface used by DisplayManager, EventBus, Events and DeviceID is provided.
+ *
+ * Time Base:
+ * - millis() is a virtual clock advanced by the host runner (deterministic animations);
+ *   Utils::Clock, and through it the LVGL tick, reads the same clock
+ * - micros() is the real monotonic clock (used for profiling only)
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <string>
+
+#define HIGH 1
+#define LOW 0
+
+// ============================================================================
+// TIME
+// ============================================================================
+
+namespace HostClock
+{
+    uint32_t now();              // Virtual milliseconds
+    void advance(uint32_t ms);   // Advance virtual time
+}
+
+inline uint32_t millis() { return HostClock::now(); }
+uint32_t micros();
+inline void delay(uint32_t ms) { HostClock::advance(ms); }
+
+// ============================================================================
+// MEMORY
+// ============================================================================
+
+inline void *ps_malloc(size_t size) { return malloc(size); }
+
+// ============================================================================
+// STRING
+// ============================================================================
+
+class String
+{
+public:
+    String() = default;
+    String(const char *s) : value(s ? s : "") {}
+    String(const std::string &s) : value(s) {}
+    String(int v) : value(std::to_string(v)) {}
+
+    const char *c_str() const { return value.c_str(); }
+    unsigned int length() const { return value.length(); }
+
+    int indexOf(char c) const
+    {
+        size_t pos = value.find(c);
+        return pos == std::string::npos ? -1 : (int)pos;
+    }
+
+    String substring(unsigned int from) const { return from < value.size() ? String(value.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const
+    {
+        if (from >= value.size() || to <= from) return String();
+        return String(value.substr(from, to - from));
+    }
+
+    bool startsWith(const String &prefix) const { return value.compare(0, prefix.value.size(), prefix.value) == 0; }
+    bool operator==(const String &other) const { return value == other.value; }
+    bool operator==(const char *other) const { return value == other; }
+
+    String &operator+=(const String &other)
+    {
+        value += other.value;
+        return *this;
+    }
+
+    friend String operator+(const String &a, const String &b) { return String(a.value + b.value); }
+    friend String operator+(const char *a, const String &b) { return String(std::string(a) + b.value); }
+    friend String operator+(const String &a, const char *b) { return String(a.value + b); }
+
+private:
+    std::string value;
+};
+
+// ============================================================================
+// SERIAL
+// ============================================================================
+
+class HostSerial
+{
+public:
+    void begin(unsigned long) {}
+    int available() { return 0; }
+    int read() { return -1; }
+    void flush() { fflush(stdout); }
+
+    void print(const char *s) { fputs(s, stdout); }
+    void print(const String &s) { fputs(s.c_str(), stdout); }
+    void println(const char *s = "") { puts(s); }
+    void println(const String &s) { puts(s.c_str()); }
+
+    int printf(const char *format, ...)
+    {
+        va_list args;
+        va_start(args, format);
+        int n = vprintf(format, args);
+        va_end(args);
+        return n;
+    }
+};
+
+extern HostSerial Serial;
+
+// ============================================================================
+// ESP SYSTEM INFO
+// ============================================================================
+
+class HostESP
+{
+public:
+    uint64_t getEfuseMac() { return 0x0000AABBCCDDEEFFULL; }
+    uint8_t getChipRevision() { return 0; }
+    const char *getChipModel() { return "host"; }
+    uint32_t getCpuFreqMHz() { return 0; }
+    uint32_t getFreeHeap() { return 0; }
+    uint32_t getMinFreeHeap() { return 0; }
+    uint32_t getFreePsram() { return 0; }
+    void restart() { exit(0); }
+};
+
+extern HostESP ESP;
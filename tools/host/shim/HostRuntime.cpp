@@ -0,0 +1,149 @@
+/**
+ * CloudMouse SDK - Host Build Runtime
+ * Definitions backing the Arduino, ESP and WiFi shims.
+ */
+
+#include "Arduino.h"
+#include "WiFi.h"
+#include <chrono>
+#include <errno.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+
+HostSerial Serial;
+HostESP ESP;
+
+// ============================================================================
+// TIME
+// ============================================================================
+
+namespace
+{
+    uint32_t virtualMs = 0;
+    const auto startTime = std::chrono::steady_clock::now();
+}
+
+uint32_t HostClock::now()
+{
+    return virtualMs;
+}
+
+void HostClock::advance(uint32_t ms)
+{
+    virtualMs += ms;
+}
+
+uint32_t micros()
+{
+    auto elapsed = std::chrono::steady_clock::now() - startTime;
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+// ============================================================================
+// NETWORK
+// ============================================================================
+
+struct WiFiClient::Socket
+{
+    int fd;
+    explicit Socket(int fd) : fd(fd) {}
+    ~Socket() { close(); }
+
+    void close()
+    {
+        if (fd >= 0) ::close(fd);
+        fd = -1;
+    }
+};
+
+WiFiClient::WiFiClient(int fd) : socket(std::make_shared<Socket>(fd)) {}
+
+uint8_t WiFiClient::connected()
+{
+    if (!socket || socket->fd < 0) return 0;
+
+    char probe;
+    ssize_t n = recv(socket->fd, &probe, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (n > 0 || (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))) return 1;
+
+    socket->close(); // Orderly shutdown or error
+    return 0;
+}
+
+int WiFiClient::available()
+{
+    if (!socket || socket->fd < 0) return 0;
+
+    int bytes = 0;
+    if (ioctl(socket->fd, FIONREAD, &bytes) < 0) return 0;
+    return bytes;
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size)
+{
+    if (!socket || socket->fd < 0) return -1;
+
+    ssize_t n = recv(socket->fd, buffer, size, MSG_DONTWAIT);
+    return n > 0 ? (int)n : -1;
+}
+
+size_t WiFiClient::write(const uint8_t *buffer, size_t size)
+{
+    if (!socket || socket->fd < 0) return 0;
+
+    ssize_t n = send(socket->fd, buffer, size, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (n >= 0) return (size_t)n;
+    if (errno != EAGAIN && errno != EWOULDBLOCK) socket->close();
+    return 0;
+}
+
+void WiFiClient::stop()
+{
+    if (socket) socket->close();
+    socket.reset();
+}
+
+void WiFiServer::begin(uint16_t listenPort)
+{
+    end();
+    if (listenPort) port = listenPort;
+
+    fd = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    if (fd < 0) return;
+
+    int reuse = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+    if (bind(fd, (sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, 4) < 0)
+    {
+        printf("❌ WiFiServer: cannot listen on port %u: %s\n", port, strerror(errno));
+        end();
+    }
+}
+
+WiFiClient WiFiServer::available()
+{
+    if (fd < 0) return WiFiClient();
+
+    int clientFd = accept4(fd, nullptr, nullptr, SOCK_NONBLOCK);
+    if (clientFd < 0) return WiFiClient();
+
+    int flag = noDelay ? 1 : 0;
+    setsockopt(clientFd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+    return WiFiClient(clientFd);
+}
+
+void WiFiServer::end()
+{
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+}
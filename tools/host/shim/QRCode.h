@@ -0,0 +1,3 @@
+// Host shim: the Arduino IDE include name for the ricmoo QRCode library
+#pragma once
+#include <qrcode.h>
@@ -0,0 +1,51 @@
+/**
+ * CloudMouse SDK - Host Build WiFi Shim
+ *
+ * WiFiServer / WiFiClient over POSIX TCP sockets, enough for DisplayMirror to serve
+ * its viewer on localhost. Sockets are non-blocking: write() may accept only part of
+ * the data, like the ESP32 client once the lwIP send buffer is full.
+ *
+ * Copies of a WiFiClient share one socket (as on ESP32); stop() closes it for all.
+ */
+
+#pragma once
+
+#include "Arduino.h"
+#include <memory>
+
+class WiFiClient
+{
+public:
+    WiFiClient() = default;
+    explicit WiFiClient(int fd);
+
+    uint8_t connected();
+    int available();
+    int read(uint8_t *buffer, size_t size);
+    size_t write(const uint8_t *buffer, size_t size);
+    void setNoDelay(bool) {}
+    void stop();
+
+    explicit operator bool() { return connected(); }
+
+private:
+    struct Socket;
+    std::shared_ptr<Socket> socket;
+};
+
+class WiFiServer
+{
+public:
+    explicit WiFiServer(uint16_t port = 80) : port(port) {}
+    ~WiFiServer() { end(); }
+
+    void begin(uint16_t listenPort = 0);
+    WiFiClient available();
+    void setNoDelay(bool enabled) { noDelay = enabled; }
+    void end();
+
+private:
+    uint16_t port;
+    int fd = -1;
+    bool noDelay = false;
+};
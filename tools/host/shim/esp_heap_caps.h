@@ -0,0 +1,24 @@
+/**
+ * CloudMouse SDK - Host Build Heap Capabilities Shim
+ * All capability-restricted allocations map to the host heap.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <malloc.h>
+
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+inline void *heap_caps_malloc(size_t size, uint32_t) { return malloc(size); }
+inline void *heap_caps_realloc(void *ptr, size_t size, uint32_t) { return realloc(ptr, size); }
+inline void heap_caps_free(void *ptr) { free(ptr); }
+inline size_t heap_caps_get_allocated_size(void *ptr) { return malloc_usable_size(ptr); }
+inline bool heap_caps_check_integrity_all(bool) { return true; }
+inline size_t heap_caps_get_free_size(uint32_t) { return 0; }
+inline size_t heap_caps_get_largest_free_block(uint32_t) { return 0; }
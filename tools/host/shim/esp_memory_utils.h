@@ -0,0 +1,8 @@
+/**
+ * CloudMouse SDK - Host Build Memory Region Shim
+ * The host has a single heap, so nothing is reported as external RAM.
+ */
+
+#pragma once
+
+inline bool esp_ptr_external_ram(const void *) { return false; }
@@ -0,0 +1,8 @@
+/**
+ * CloudMouse SDK - Host Build ESP System Shim
+ * ESP object is declared in Arduino.h; nothing else is needed by UI modules.
+ */
+
+#pragma once
+
+#include "Arduino.h"
@@ -0,0 +1,50 @@
+/**
+ * CloudMouse SDK - Host Build FreeRTOS Queue Shim
+ *
+ * Fixed-capacity FIFO with copy semantics. Timeouts are ignored: the host runner is
+ * single-threaded, so a full or empty queue can never change while waiting.
+ */
+
+#pragma once
+
+#include "FreeRTOS.h"
+#include <deque>
+#include <vector>
+#include <string.h>
+
+struct HostQueue
+{
+    size_t capacity;
+    size_t itemSize;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+typedef HostQueue *QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+    return new HostQueue{length, itemSize, {}};
+}
+
+inline void vQueueDelete(QueueHandle_t queue) { delete queue; }
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t)
+{
+    if (!queue || queue->items.size() >= queue->capacity) return pdFAIL;
+    const uint8_t *bytes = static_cast<const uint8_t *>(item);
+    queue->items.emplace_back(bytes, bytes + queue->itemSize);
+    return pdPASS;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t)
+{
+    if (!queue || queue->items.empty()) return pdFAIL;
+    memcpy(item, queue->items.front().data(), queue->itemSize);
+    queue->items.pop_front();
+    return pdPASS;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    return queue ? queue->items.size() : 0;
+}
@@ -0,0 +1,9 @@
+/**
+ * CloudMouse SDK - Host Build FreeRTOS Task Shim
+ */
+
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef void *TaskHandle_t;
@@ -0,0 +1,209 @@
+/**
+ * CloudMouse SDK - Pixel Kernel Tests (host)
+ *
+ * Bit-exactness of the word-parallel flush kernels against their per-pixel
+ * reference, run by ctest:
+ *
+ *   cmake -S tools/host -B build-host && cmake --build build-host
+ *   ctest --test-dir build-host --output-on-failure
+ *
+ * Coverage:
+ * - PixelConverter::rgb565ToRgb666: all 65536 RGB565 values in both byte orders,
+ *   every source start offset 0-3 and tail length 0-3, no writes past the output
+ * - IndexedPalette::expandRgb666 with the UiTheme palette: all 256 L8 values, every
+ *   source start offset 0-3 and tail length 0-3, against the per-pixel conversion of
+ *   its RGB565 LUT; every palette colour maps back to its own RGB565 value
+ */
+
+#include <Arduino.h>
+#include <vector>
+#include "../../../lib/hardware/PixelConverter.h"
+#include "../../../lib/hardware/IndexedPalette.h"
+#include "../../../lib/hardware/UiTheme.h"
+
+using namespace CloudMouse::Hardware;
+
+namespace
+{
+    int failures = 0;
+
+    void check(bool ok, const char *what, size_t index)
+    {
+        if (ok) return;
+        if (failures < 20)
+        {
+            printf("FAIL %s (index %zu)\n", what, index);
+        }
+        failures++;
+    }
+
+    // Output area followed by guard bytes that must stay untouched
+    const uint8_t GUARD = 0xA5;
+    const size_t GUARD_BYTES = 16;
+
+    void compareBuffers(const std::vector<uint8_t> &fast, const std::vector<uint8_t> &reference,
+                        size_t bytes, const char *what)
+    {
+        for (size_t i = 0; i < bytes; i++)
+        {
+            check(fast[i] == reference[i], what, i);
+        }
+        for (size_t i = bytes; i < bytes + GUARD_BYTES; i++)
+        {
+            check(fast[i] == GUARD, "write past output", i);
+        }
+    }
+
+    // ========================================================================
+    // RGB565 -> RGB666
+    // ========================================================================
+
+    void testRgb565AllValues(bool swapped)
+    {
+        std::vector<uint16_t> src(65536);
+        for (size_t i = 0; i < src.size(); i++) src[i] = (uint16_t)i;
+
+        std::vector<uint8_t> fast(PixelConverter::outputSize(src.size()) + GUARD_BYTES, GUARD);
+        std::vector<uint8_t> reference(fast.size(), GUARD);
+
+        PixelConverter::rgb565ToRgb666(fast.data(), src.data(), src.size(), swapped);
+        PixelConverter::rgb565ToRgb666Reference(reference.data(), src.data(), src.size(), swapped);
+
+        compareBuffers(fast, reference, PixelConverter::outputSize(src.size()),
+                       swapped ? "rgb565 swapped, all values" : "rgb565 native, all values");
+    }
+
+    void testRgb565Offsets(bool swapped)
+    {
+        // Bands may start on any pixel of the render buffer; destinations are staging (aligned)
+        std::vector<uint16_t> src(64 + 8);
+        for (size_t i = 0; i < src.size(); i++) src[i] = (uint16_t)(i * 0x9E37u + 0x1234u);
+
+        for (size_t start = 0; start < 4; start++)
+        {
+            for (size_t count = 0; count <= 64 + 3; count++)
+            {
+                if (start + count > src.size()) break;
+
+                std::vector<uint32_t> fastWords((PixelConverter::outputSize(count) + GUARD_BYTES) / 4 + 1);
+                uint8_t *fastBytes = (uint8_t *)fastWords.data();
+                std::vector<uint8_t> fast(PixelConverter::outputSize(count) + GUARD_BYTES, GUARD);
+                std::vector<uint8_t> reference(fast.size(), GUARD);
+                memset(fastBytes, GUARD, fast.size());
+
+                PixelConverter::rgb565ToRgb666(fastBytes, src.data() + start, count, swapped);
+                PixelConverter::rgb565ToRgb666Reference(reference.data(), src.data() + start, count, swapped);
+                memcpy(fast.data(), fastBytes, fast.size());
+
+                compareBuffers(fast, reference, PixelConverter::outputSize(count),
+                               swapped ? "rgb565 swapped, offset/tail" : "rgb565 native, offset/tail");
+            }
+        }
+    }
+
+    // ========================================================================
+    // L8 -> RGB666 (indexed colour)
+    // ========================================================================
+
+    const uint32_t THEME_COLORS[] = {
+        UiTheme::COLOR_BG, UiTheme::COLOR_TEXT, UiTheme::COLOR_ACCENT, UiTheme::COLOR_SUCCESS,
+        UiTheme::COLOR_WARNING, UiTheme::COLOR_HEADER, UiTheme::COLOR_HINT, UiTheme::COLOR_SETUP_BG,
+        UiTheme::COLOR_CONFIRMED_BG};
+
+    void buildPalette(IndexedPalette &palette)
+    {
+        for (uint32_t hex : THEME_COLORS) palette.add(hex);
+    }
+
+    // Per-pixel specification: the LUT's RGB565 colour through the reference converter
+    void expandReference(const IndexedPalette &palette, uint8_t *dst, const uint8_t *src, size_t pixels)
+    {
+        for (size_t i = 0; i < pixels; i++)
+        {
+            const uint16_t color = palette.toRgb565(src[i]);
+            PixelConverter::rgb565ToRgb666Reference(dst + i * 3, &color, 1, false);
+        }
+    }
+
+    void testPaletteColors()
+    {
+        IndexedPalette palette;
+        buildPalette(palette);
+
+        for (uint32_t hex : THEME_COLORS)
+        {
+            const lv_color_t color = lv_color_hex(hex);
+            check(palette.toRgb565(lv_color_luminance(color)) == lv_color_to_u16(color),
+                  "palette colour exact", hex);
+        }
+    }
+
+    void testPaletteAllValues()
+    {
+        IndexedPalette palette;
+        buildPalette(palette);
+
+        std::vector<uint8_t> src(256);
+        for (size_t i = 0; i < src.size(); i++) src[i] = (uint8_t)i;
+
+        std::vector<uint32_t> fastWords((src.size() * 3 + GUARD_BYTES) / 4 + 1);
+        uint8_t *fastBytes = (uint8_t *)fastWords.data();
+        std::vector<uint8_t> fast(src.size() * 3 + GUARD_BYTES, GUARD);
+        std::vector<uint8_t> reference(fast.size(), GUARD);
+        memset(fastBytes, GUARD, fast.size());
+
+        palette.expandRgb666(fastBytes, src.data(), src.size());
+        expandReference(palette, reference.data(), src.data(), src.size());
+        memcpy(fast.data(), fastBytes, fast.size());
+
+        compareBuffers(fast, reference, src.size() * 3, "l8 expand, all values");
+    }
+
+    void testPaletteOffsets()
+    {
+        IndexedPalette palette;
+        buildPalette(palette);
+
+        std::vector<uint8_t> src(64 + 8);
+        for (size_t i = 0; i < src.size(); i++) src[i] = (uint8_t)(i * 37 + 11);
+
+        for (size_t start = 0; start < 4; start++)
+        {
+            for (size_t count = 0; count <= 64 + 3; count++)
+            {
+                if (start + count > src.size()) break;
+
+                std::vector<uint32_t> fastWords((count * 3 + GUARD_BYTES) / 4 + 1);
+                uint8_t *fastBytes = (uint8_t *)fastWords.data();
+                std::vector<uint8_t> fast(count * 3 + GUARD_BYTES, GUARD);
+                std::vector<uint8_t> reference(fast.size(), GUARD);
+                memset(fastBytes, GUARD, fast.size());
+
+                palette.expandRgb666(fastBytes, src.data() + start, count);
+                expandReference(palette, reference.data(), src.data() + start, count);
+                memcpy(fast.data(), fastBytes, fast.size());
+
+                compareBuffers(fast, reference, count * 3, "l8 expand, offset/tail");
+            }
+        }
+    }
+}
+
+int main()
+{
+    testRgb565AllValues(false);
+    testRgb565AllValues(true);
+    testRgb565Offsets(false);
+    testRgb565Offsets(true);
+    testPaletteColors();
+    testPaletteAllValues();
+    testPaletteOffsets();
+
+    if (failures)
+    {
+        printf("❌ %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("✅ Pixel kernels bit-exact\n");
+    return 0;
+}
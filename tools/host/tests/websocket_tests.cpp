@@ -0,0 +1,89 @@
+/**
+ * CloudMouse SDK - WebSocket Handshake Tests (host)
+ *
+ * Sec-WebSocket-Accept values of the display mirror handshake, run by ctest
+ * (see pixel_tests.cpp for the commands).
+ *
+ * Coverage:
+ * - RFC 6455 section 1.3 example key
+ * - Browser-style 24-character keys
+ * - Keys putting key + GUID on both sides of the SHA-1 padding boundaries
+ *   (55, 56 and 64 bytes)
+ * - Rejection of empty and oversized keys and short output buffers
+ */
+
+#include <Arduino.h>
+#include "../../../lib/network/WebSocketHandshake.h"
+
+using namespace CloudMouse::Network;
+
+namespace
+{
+    int failures = 0;
+
+    void check(bool ok, const char *what, const char *detail)
+    {
+        if (ok) return;
+        printf("FAIL %s (%s)\n", what, detail);
+        failures++;
+    }
+
+    struct Vector
+    {
+        const char *key;
+        const char *accept;
+    };
+
+    // Reference values from Python hashlib / base64
+    const Vector VECTORS[] = {
+        {"dGhlIHNhbXBsZSBub25jZQ==", "s3pPLMBiTxaQ9kYGzzhZRbK+xOo="}, // RFC 6455
+        {"x3JJHMbDL1EzLkh9GBhXDw==", "HSmrc0sMlYUkAGmm5OPpG2HaGWk="},
+        {"AQIDBAUGBwgJCgsMDQ4PEA==", "C/0nmHhBztSRGR1CwL6Tf4ZjwpY="},
+        {"abcdefghijklmnopqrs", "e5nfl7ayxOkM7i0NSGMv++0gU/w="},          // 55 bytes hashed
+        {"abcdefghijklmnopqrst", "AsD5pA85sKFU9jjywWADP+ER30s="},         // 56 bytes hashed
+        {"abcdefghijklmnopqrstuvwxyz01", "jL4II6ks7RywSTUafFd+cJ7g5i0="}, // 64 bytes hashed
+    };
+
+    // ========================================================================
+    // ACCEPT KEY
+    // ========================================================================
+
+    void testVectors()
+    {
+        for (const Vector &vector : VECTORS)
+        {
+            char accept[WEBSOCKET_ACCEPT_SIZE];
+            memset(accept, 0, sizeof(accept));
+            const bool ok = WebSocket::acceptKey(vector.key, accept, sizeof(accept));
+            check(ok, "accept key computed", vector.key);
+            check(ok && strcmp(accept, vector.accept) == 0, "accept key matches", vector.key);
+        }
+    }
+
+    void testRejects()
+    {
+        char accept[WEBSOCKET_ACCEPT_SIZE];
+        char longKey[WEBSOCKET_KEY_MAX + 2];
+        memset(longKey, 'a', sizeof(longKey) - 1);
+        longKey[sizeof(longKey) - 1] = '\0';
+
+        check(!WebSocket::acceptKey("", accept, sizeof(accept)), "empty key rejected", "");
+        check(!WebSocket::acceptKey(nullptr, accept, sizeof(accept)), "null key rejected", "");
+        check(!WebSocket::acceptKey(longKey, accept, sizeof(accept)), "oversized key rejected", "");
+        check(!WebSocket::acceptKey(VECTORS[0].key, accept, sizeof(accept) - 1), "short buffer rejected", "");
+    }
+}
+
+int main()
+{
+    testVectors();
+    testRejects();
+
+    if (failures)
+    {
+        printf("❌ %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("✅ WebSocket handshake vectors match\n");
+    return 0;
+}